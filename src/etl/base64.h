@@ -172,6 +172,14 @@ namespace etl
 
   protected:
 
+    enum
+    {
+      // Returned by sextet_value for a character not in the table.
+      // Outside of the range of a sextet, so that the results for a whole
+      // block may be ORed together and validated with a single test.
+      Invalid_Sextet = 0x100
+    };
+
     ETL_CONSTEXPR14 base64(const char* encoder_table_, bool use_padding_)
       : encoder_table(encoder_table_)
       , use_padding(use_padding_)
@@ -202,6 +210,40 @@ namespace etl
       return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,";
     }
 
+    //*************************************************************************
+    // Translates a character into its sextet value.
+    // The first 62 characters are common to all of the character sets, so only
+    // the last two need to be looked up in the table.
+    // Returns Invalid_Sextet if the character is not in the table.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR14 uint32_t sextet_value(char c) const
+    {
+      if ((c >= 'A') && (c <= 'Z'))
+      {
+        return static_cast<uint32_t>(c - 'A');
+      }
+      else if ((c >= 'a') && (c <= 'z'))
+      {
+        return static_cast<uint32_t>(c - 'a') + 26U;
+      }
+      else if ((c >= '0') && (c <= '9'))
+      {
+        return static_cast<uint32_t>(c - '0') + 52U;
+      }
+      else if (c == encoder_table[62])
+      {
+        return 62U;
+      }
+      else if (c == encoder_table[63])
+      {
+        return 63U;
+      }
+      else
+      {
+        return static_cast<uint32_t>(Invalid_Sextet);
+      }
+    }
+
     const char* encoder_table;
     const bool  use_padding;
   };
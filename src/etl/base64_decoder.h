@@ -105,6 +105,11 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      if (etl::is_random_access_iterator<TInputIterator>::value)
+      {
+        return decode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+      }
+
       while (input_begin != input_end)
       {
         if (!decode(*input_begin++))
@@ -124,6 +129,13 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      decode_blocks(input_begin, input_length);
+
+      if (error())
+      {
+        return false;
+      }
+
       while (input_length-- != 0)
       {
         if (!decode(*input_begin++))
@@ -320,12 +332,11 @@ namespace etl
     template <typename T>
     ETL_CONSTEXPR14 uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet          = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint32_t index = sextet_value(static_cast<char>(sextet));
 
-      if (p_sextet != encoder_table_end)
+      if (index != static_cast<uint32_t>(Invalid_Sextet))
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
@@ -334,6 +345,63 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Decodes whole blocks of four characters directly to the output buffer,
+    /// bypassing the input buffer.
+    /// Each block is validated as a whole. Stops at the first block that is not
+    /// four valid sextets, such as padding or invalid data, leaving it for the
+    /// character by character path.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 void decode_blocks(TInputIterator& input_begin, size_t& input_length)
+    {
+      while ((input_buffer_length == 0U) && !padding_received && (input_length >= 4U))
+      {
+        size_t n_blocks = etl::min(input_length / 4U, (output_buffer_max_size - output_buffer_length) / 3U);
+
+        if (n_blocks == 0U)
+        {
+          // Let the character by character path report the overflow.
+          return;
+        }
+
+        while (n_blocks-- != 0U)
+        {
+          const char c0 = static_cast<char>(*input_begin++);
+          const char c1 = static_cast<char>(*input_begin++);
+          const char c2 = static_cast<char>(*input_begin++);
+          const char c3 = static_cast<char>(*input_begin++);
+          input_length -= 4U;
+
+          const uint32_t s0 = sextet_value(c0);
+          const uint32_t s1 = sextet_value(c1);
+          const uint32_t s2 = sextet_value(c2);
+          const uint32_t s3 = sextet_value(c3);
+
+          if (((s0 | s1 | s2 | s3) & static_cast<uint32_t>(Invalid_Sextet)) != 0U)
+          {
+            // Hand this block to the character by character path.
+            static_cast<void>(decode(c0) && decode(c1) && decode(c2) && decode(c3));
+            return;
+          }
+
+          const uint32_t sextets = (s0 << 18) | (s1 << 12) | (s2 << 6) | s3;
+
+          unsigned char* p_out = p_output_buffer + output_buffer_length;
+          p_out[0]             = static_cast<unsigned char>(sextets >> 16);
+          p_out[1]             = static_cast<unsigned char>(sextets >> 8);
+          p_out[2]             = static_cast<unsigned char>(sextets);
+          output_buffer_length += 3U;
+        }
+
+        if (callback.is_valid() && output_buffer_is_full())
+        {
+          callback(span());
+          reset_output_buffer();
+        }
+      }
+    }
+
     //*************************************************************************
     /// Gets the padding character
     //*************************************************************************
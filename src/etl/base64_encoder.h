@@ -103,6 +103,8 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      encode_blocks(input_begin, input_length);
+
       while (input_length-- != 0)
       {
         if (!encode(*input_begin++))
@@ -122,6 +124,11 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      if (etl::is_random_access_iterator<TInputIterator>::value)
+      {
+        return encode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+      }
+
       while (input_begin != input_end)
       {
         if (!encode(*input_begin++))
@@ -393,6 +400,50 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Encodes whole blocks of three octets directly to the output buffer,
+    /// bypassing the input buffer and the per character checks.
+    /// Leaves any remaining input for the octet by octet path.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 void encode_blocks(TInputIterator& input_begin, size_t& input_length)
+    {
+      while ((input_buffer_length == 0U) && (input_length >= 3U))
+      {
+        size_t n_blocks = etl::min(input_length / 3U, (output_buffer_max_size - output_buffer_length) / 4U);
+
+        if (n_blocks == 0U)
+        {
+          // Let the octet by octet path report the overflow.
+          return;
+        }
+
+        input_length -= n_blocks * 3U;
+
+        char* p_out = p_output_buffer + output_buffer_length;
+        output_buffer_length += n_blocks * 4U;
+
+        while (n_blocks-- != 0U)
+        {
+          uint32_t octets = static_cast<uint32_t>(static_cast<uint8_t>(*input_begin++)) << 16;
+          octets |= static_cast<uint32_t>(static_cast<uint8_t>(*input_begin++)) << 8;
+          octets |= static_cast<uint32_t>(static_cast<uint8_t>(*input_begin++));
+
+          p_out[0] = encoder_table[(octets >> 18) & 0x3F];
+          p_out[1] = encoder_table[(octets >> 12) & 0x3F];
+          p_out[2] = encoder_table[(octets >> 6) & 0x3F];
+          p_out[3] = encoder_table[(octets >> 0) & 0x3F];
+          p_out += 4;
+        }
+
+        if (callback.is_valid() && output_buffer_is_full())
+        {
+          callback(span());
+          reset_output_buffer();
+        }
+      }
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
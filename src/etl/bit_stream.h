@@ -44,6 +44,7 @@ SOFTWARE.
 
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
@@ -1455,6 +1456,759 @@ namespace etl
   {
     return stream.read<bool>();
   }
+
+#if ETL_USING_64BIT_TYPES
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// Reverses the order of the bits within each byte of a word.
+    //*************************************************************************
+    inline uint64_t reverse_bits_in_bytes(uint64_t value)
+    {
+      value = ((value >> 1U) & UINT64_C(0x5555555555555555)) | ((value & UINT64_C(0x5555555555555555)) << 1U);
+      value = ((value >> 2U) & UINT64_C(0x3333333333333333)) | ((value & UINT64_C(0x3333333333333333)) << 2U);
+      value = ((value >> 4U) & UINT64_C(0x0F0F0F0F0F0F0F0F)) | ((value & UINT64_C(0x0F0F0F0F0F0F0F0F)) << 4U);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Converts between an accumulator word and its in-stream byte image.
+    /// MSB first streams hold the word big endian.
+    /// LSB first streams hold the word little endian, with the bits of each
+    /// byte reversed, so that the first bit in the stream is bit 0 of the word.
+    //*************************************************************************
+    inline uint64_t to_stream_image(uint64_t word, bool msb_first)
+    {
+      const bool is_little = (etl::endianness::value() == etl::endian::little);
+
+      if (msb_first)
+      {
+        return is_little ? etl::reverse_bytes(word) : word;
+      }
+      else
+      {
+        word = reverse_bits_in_bytes(word);
+        return is_little ? word : etl::reverse_bytes(word);
+      }
+    }
+
+    //*********************************
+    inline uint64_t from_stream_image(uint64_t image, bool msb_first)
+    {
+      // The conversion is its own inverse.
+      return to_stream_image(image, msb_first);
+    }
+
+    //*************************************************************************
+    /// The constants of fast_bit_stream_reader.
+    /// A template, so that the out of class definition may be in the header.
+    //*************************************************************************
+    template <typename T = void>
+    struct fast_bit_stream_reader_constants
+    {
+      static ETL_CONSTANT uint_least8_t Max_Peek_Bits = 56U;
+    };
+
+    template <typename T>
+    ETL_CONSTANT uint_least8_t fast_bit_stream_reader_constants<T>::Max_Peek_Bits;
+  } // namespace private_bit_stream
+
+  //***************************************************************************
+  /// Writes bit streams through a 64 bit accumulator.
+  /// Produces the same stream as etl::bit_stream_writer for the same bit order
+  /// and byte order, but stores a whole word to the buffer every 64 bits rather
+  /// than stepping through the stream one char at a time.
+  /// Pending bits are only stored to the buffer when flush() is called.
+  //***************************************************************************
+  class fast_bit_stream_writer
+  {
+  public:
+
+    typedef char              value_type;
+    typedef value_type*       iterator;
+    typedef const value_type* const_iterator;
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_writer(const etl::span<char, Length>& span_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(span_.begin())
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_writer(const etl::span<unsigned char, Length>& span_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<char*>(span_.begin()))
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from range.
+    //***************************************************************************
+    fast_bit_stream_writer(void* begin_, void* end_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<char*>(begin_))
+      , length_chars(static_cast<size_t>(etl::distance(reinterpret_cast<char*>(begin_), reinterpret_cast<char*>(end_))))
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    fast_bit_stream_writer(void* begin_, size_t length_chars_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<char*>(begin_))
+      , length_chars(length_chars_)
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Sets the indexes back to the beginning of the stream.
+    //***************************************************************************
+    void restart()
+    {
+      accumulator  = 0U;
+      pending_bits = 0U;
+      char_index   = 0U;
+    }
+
+    //***************************************************************************
+    /// Returns the maximum capacity in bytes.
+    //***************************************************************************
+    size_t capacity_bytes() const
+    {
+      return length_chars;
+    }
+
+    //***************************************************************************
+    /// Returns the maximum capacity in bits.
+    //***************************************************************************
+    size_t capacity_bits() const
+    {
+      return length_chars * CHAR_BIT;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if nothing has been written to the stream.
+    //***************************************************************************
+    bool empty() const
+    {
+      return (size_bits() == 0U);
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the stream is full.
+    //***************************************************************************
+    bool full() const
+    {
+      return (available_bits() == 0U);
+    }
+
+    //***************************************************************************
+    /// Writes a boolean to the stream
+    //***************************************************************************
+    void write_unchecked(bool value)
+    {
+      put_bits(value ? 1U : 0U, 1U);
+    }
+
+    //***************************************************************************
+    /// Writes a boolean to the stream
+    //***************************************************************************
+    bool write(bool value)
+    {
+      bool success = (available_bits() > 0U);
+
+      if (success)
+      {
+        write_unchecked(value);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// For integral types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type write_unchecked(T value, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      ETL_ASSERT(nbits <= (CHAR_BIT * sizeof(T)), ETL_ERROR_GENERIC("fast_bit_stream_writer::write_unchecked: nbits too large"));
+
+      unsigned_t uvalue = static_cast<unsigned_t>(value);
+
+      // Apply the byte order (endianness).
+      // Only meaningful when writing the full width of the type.
+      if ((byte_order == etl::endian::little) && (nbits == (CHAR_BIT * sizeof(T))))
+      {
+        uvalue = etl::reverse_bytes(uvalue);
+      }
+
+      if (nbits != 0U)
+      {
+        put_bits(static_cast<uint64_t>(uvalue) & (etl::integral_limits<uint64_t>::max >> (64U - nbits)), nbits);
+      }
+    }
+
+    //***************************************************************************
+    /// For integral types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type write(T value, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      bool success = (available_bits() >= nbits);
+
+      if (success)
+      {
+        write_unchecked(value, nbits);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Skip n bits, writing zeros, up to the maximum space available.
+    /// Returns <b>true</b> if the skip was possible.
+    /// Returns <b>false</b> if the full skip size was not possible.
+    //***************************************************************************
+    bool skip(size_t nbits)
+    {
+      bool success = (nbits <= available_bits());
+
+      if (success)
+      {
+        while (nbits != 0U)
+        {
+          const uint_least8_t width = static_cast<uint_least8_t>(etl::min(nbits, size_t(64U)));
+
+          put_bits(0U, width);
+          nbits -= width;
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Stores the pending bits to the buffer, zero padding the last char.
+    /// The stream position is unchanged, so writing may continue.
+    //***************************************************************************
+    void flush()
+    {
+      const size_t n = (pending_bits + CHAR_BIT - 1U) / CHAR_BIT;
+
+      if (n != 0U)
+      {
+        const uint64_t image = private_bit_stream::to_stream_image(accumulator, msb_first);
+
+        memcpy(pdata + char_index, &image, n);
+      }
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes used in the stream.
+    //***************************************************************************
+    size_t size_bytes() const
+    {
+      return char_index + ((pending_bits + CHAR_BIT - 1U) / CHAR_BIT);
+    }
+
+    //***************************************************************************
+    /// Returns the number of bits used in the stream.
+    //***************************************************************************
+    size_t size_bits() const
+    {
+      return (char_index * CHAR_BIT) + pending_bits;
+    }
+
+    //***************************************************************************
+    /// The number of 'bit width' available in the stream.
+    //***************************************************************************
+    size_t available(size_t nbits) const
+    {
+      return available_bits() / nbits;
+    }
+
+    //***************************************************************************
+    /// The number of bits left in the stream.
+    //***************************************************************************
+    size_t available_bits() const
+    {
+      return capacity_bits() - size_bits();
+    }
+
+    //***************************************************************************
+    /// Returns start of the stream.
+    //***************************************************************************
+    iterator begin()
+    {
+      return pdata;
+    }
+
+    //***************************************************************************
+    /// Returns start of the stream.
+    //***************************************************************************
+    const_iterator begin() const
+    {
+      return pdata;
+    }
+
+    //***************************************************************************
+    /// Returns end of the stream.
+    //***************************************************************************
+    iterator end()
+    {
+      return pdata + size_bytes();
+    }
+
+    //***************************************************************************
+    /// Returns end of the stream.
+    //***************************************************************************
+    const_iterator end() const
+    {
+      return pdata + size_bytes();
+    }
+
+    //***************************************************************************
+    /// Returns a span of the used portion of the stream.
+    /// Call flush() first to store any pending bits.
+    //***************************************************************************
+    etl::span<char> used_data()
+    {
+      return etl::span<char>(pdata, pdata + size_bytes());
+    }
+
+    //***************************************************************************
+    /// Returns a span of the used portion of the stream.
+    /// Call flush() first to store any pending bits.
+    //***************************************************************************
+    etl::span<const char> used_data() const
+    {
+      return etl::span<const char>(pdata, pdata + size_bytes());
+    }
+
+    //***************************************************************************
+    /// Returns a span of whole the stream.
+    //***************************************************************************
+    etl::span<char> data()
+    {
+      return etl::span<char>(pdata, pdata + length_chars);
+    }
+
+    //***************************************************************************
+    /// Returns a span of whole the stream.
+    //***************************************************************************
+    etl::span<const char> data() const
+    {
+      return etl::span<const char>(pdata, pdata + length_chars);
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Adds 1 to 64 bits to the accumulator, storing it when it fills.
+    /// MSB first streams fill the accumulator from the top.
+    /// LSB first streams fill the accumulator from the bottom.
+    //***************************************************************************
+    void put_bits(uint64_t value, uint_least8_t nbits)
+    {
+      const size_t total = pending_bits + nbits;
+
+      if (msb_first)
+      {
+        if (total < 64U)
+        {
+          accumulator |= value << (64U - total);
+          pending_bits = total;
+        }
+        else
+        {
+          const size_t remaining = total - 64U;
+
+          accumulator |= value >> remaining;
+          store_word();
+          accumulator  = (value << 1U) << (63U - remaining);
+          pending_bits = remaining;
+        }
+      }
+      else
+      {
+        accumulator |= value << pending_bits;
+
+        if (total < 64U)
+        {
+          pending_bits = total;
+        }
+        else
+        {
+          store_word();
+          accumulator  = (value >> 1U) >> (63U - pending_bits);
+          pending_bits = total - 64U;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Store the full accumulator to the buffer.
+    //***************************************************************************
+    void store_word()
+    {
+      const uint64_t image = private_bit_stream::to_stream_image(accumulator, msb_first);
+
+      memcpy(pdata + char_index, &image, sizeof(image));
+      char_index += sizeof(image);
+    }
+
+    char* const       pdata;        ///< The start of the bitstream buffer.
+    const size_t      length_chars; ///< The length of the bitstream buffer.
+    const bool        msb_first;    ///< The bit order of the stream data.
+    const etl::endian byte_order;   ///< The byte order (endianness) of the stream data.
+    uint64_t          accumulator;  ///< The bits not yet stored to the buffer.
+    size_t            pending_bits; ///< The number of bits in the accumulator.
+    size_t            char_index;   ///< The index of the next word to store.
+  };
+
+  //***************************************************************************
+  /// Reads bit streams through 64 bit word loads.
+  /// Reads the same stream as etl::bit_stream_reader for the same bit order
+  /// and byte order. Up to Max_Peek_Bits may be examined with peek() and then
+  /// removed with consume().
+  //***************************************************************************
+  class fast_bit_stream_reader : public private_bit_stream::fast_bit_stream_reader_constants<>
+  {
+  public:
+
+    typedef char        value_type;
+    typedef const char* const_iterator;
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_reader(const etl::span<char, Length>& span_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(span_.begin())
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_reader(const etl::span<unsigned char, Length>& span_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<const char*>(span_.begin()))
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_reader(const etl::span<const char, Length>& span_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(span_.begin())
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    template <size_t Length>
+    fast_bit_stream_reader(const etl::span<const unsigned char, Length>& span_, etl::bit_order bit_order_,
+                           etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<const char*>(span_.begin()))
+      , length_chars(span_.size_bytes())
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from range.
+    //***************************************************************************
+    fast_bit_stream_reader(const void* begin_, const void* end_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<const char*>(begin_))
+      , length_chars(static_cast<size_t>(etl::distance(reinterpret_cast<const char*>(begin_), reinterpret_cast<const char*>(end_))))
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Construct from begin and length.
+    //***************************************************************************
+    fast_bit_stream_reader(const void* begin_, size_t length_, etl::bit_order bit_order_, etl::endian byte_order_ = etl::endian::big)
+      : pdata(reinterpret_cast<const char*>(begin_))
+      , length_chars(length_)
+      , msb_first(bit_order_ == etl::bit_order::msb_first)
+      , byte_order(byte_order_)
+    {
+      restart();
+    }
+
+    //***************************************************************************
+    /// Sets the indexes back to the beginning of the stream.
+    //***************************************************************************
+    void restart()
+    {
+      bit_index = 0U;
+    }
+
+    //***************************************************************************
+    /// Returns the next 'nbits' bits of the stream without consuming them.
+    /// 'nbits' must not be larger than Max_Peek_Bits.
+    /// Bits past the end of the stream read as zero.
+    //***************************************************************************
+    uint64_t peek(uint_least8_t nbits) const
+    {
+      ETL_ASSERT(nbits <= Max_Peek_Bits, ETL_ERROR_GENERIC("fast_bit_stream_reader::peek: nbits too large"));
+
+      const uint64_t word  = load_word();
+      const size_t   shift = bit_index % CHAR_BIT;
+
+      if (msb_first)
+      {
+        return ((word << shift) >> (63U - nbits)) >> 1U;
+      }
+      else
+      {
+        return (word >> shift) & ((uint64_t(1U) << nbits) - 1U);
+      }
+    }
+
+    //***************************************************************************
+    /// Removes 'nbits' bits from the stream.
+    //***************************************************************************
+    void consume(size_t nbits)
+    {
+      bit_index += nbits;
+    }
+
+    //***************************************************************************
+    /// For bool types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_same<bool, T>::value, bool>::type read_unchecked()
+    {
+      return get_bits(1U) != 0U;
+    }
+
+    //***************************************************************************
+    /// For bool types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_same<bool, T>::value, etl::optional<bool> >::type read()
+    {
+      etl::optional<bool> result;
+
+      if (available_bits() > 0U)
+      {
+        result = read_unchecked<bool>();
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// For integral types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if< etl::is_integral<T>::value && !etl::is_same<bool, T>::value, T>::type read_unchecked(uint_least8_t nbits = CHAR_BIT
+                                                                                                                                        * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      ETL_ASSERT(nbits <= (CHAR_BIT * sizeof(T)), ETL_ERROR_GENERIC("fast_bit_stream_reader::read_unchecked: nbits too large"));
+
+      unsigned_t value = static_cast<unsigned_t>(get_bits(nbits));
+
+      // Apply the byte order (endianness).
+      // Only meaningful when reading the full width of the type.
+      if ((byte_order == etl::endian::little) && (nbits == (CHAR_BIT * sizeof(T))))
+      {
+        value = etl::reverse_bytes(value);
+      }
+
+      if (etl::is_signed<T>::value && (nbits != (CHAR_BIT * sizeof(T))))
+      {
+        value = etl::sign_extend<unsigned_t, unsigned_t>(value, nbits);
+      }
+
+      return static_cast<T>(value);
+    }
+
+    //***************************************************************************
+    /// For integral types
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, etl::optional<T> >::type
+      read(uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      etl::optional<T> result;
+
+      // Do we have enough bits?
+      if (available_bits() >= nbits)
+      {
+        result = read_unchecked<T>(nbits);
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Skip n bits, up to the maximum space available.
+    /// Returns <b>true</b> if the skip was possible.
+    /// Returns <b>false</b> if the full skip size was not possible.
+    //***************************************************************************
+    bool skip(size_t nbits)
+    {
+      bool success = (nbits <= available_bits());
+
+      if (success)
+      {
+        consume(nbits);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes in the stream buffer.
+    //***************************************************************************
+    size_t size_bytes() const
+    {
+      return length_chars;
+    }
+
+    //***************************************************************************
+    /// Returns the number of bits in the stream buffer.
+    //***************************************************************************
+    size_t size_bits() const
+    {
+      return length_chars * CHAR_BIT;
+    }
+
+    //***************************************************************************
+    /// The number of bits left in the stream.
+    //***************************************************************************
+    size_t available_bits() const
+    {
+      return size_bits() - bit_index;
+    }
+
+    //***************************************************************************
+    /// Returns start of the stream.
+    //***************************************************************************
+    const_iterator begin() const
+    {
+      return pdata;
+    }
+
+    //***************************************************************************
+    /// Returns end of the stream.
+    //***************************************************************************
+    const_iterator end() const
+    {
+      return pdata + size_bytes();
+    }
+
+    //***************************************************************************
+    /// Returns a span of whole the stream.
+    //***************************************************************************
+    etl::span<const char> data() const
+    {
+      return etl::span<const char>(pdata, pdata + length_chars);
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Reads and consumes 0 to 64 bits.
+    /// The first bit in the stream is the MSB of the result for MSB first
+    /// streams and the LSB for LSB first streams.
+    //***************************************************************************
+    uint64_t get_bits(uint_least8_t nbits)
+    {
+      uint64_t value;
+
+      if (nbits <= Max_Peek_Bits)
+      {
+        value = peek(nbits);
+        consume(nbits);
+      }
+      else if (msb_first)
+      {
+        const uint64_t high = get_bits(nbits - 32U);
+        value               = (high << 32U) | get_bits(32U);
+      }
+      else
+      {
+        const uint64_t low = get_bits(32U);
+        value              = low | (get_bits(nbits - 32U) << 32U);
+      }
+
+      return value;
+    }
+
+    //***************************************************************************
+    /// Loads the 64 bits starting at the char containing the current bit.
+    /// Chars past the end of the stream load as zero.
+    //***************************************************************************
+    uint64_t load_word() const
+    {
+      const size_t index = bit_index / CHAR_BIT;
+      uint64_t     image = 0U;
+
+      if ((index + sizeof(image)) <= length_chars)
+      {
+        memcpy(&image, pdata + index, sizeof(image));
+      }
+      else if (index < length_chars)
+      {
+        memcpy(&image, pdata + index, length_chars - index);
+      }
+
+      return private_bit_stream::from_stream_image(image, msb_first);
+    }
+
+    const char*       pdata;        ///< The start of the bitstream buffer.
+    const size_t      length_chars; ///< The length, in char, of the bitstream buffer.
+    const bool        msb_first;    ///< The bit order of the stream data.
+    const etl::endian byte_order;   ///< The byte order (endianness) of the stream data.
+    size_t            bit_index;    ///< The index of the next bit in the bitstream buffer.
+  };
+#endif
 } // namespace etl
 
 #include "private/minmax_pop.h"
@@ -34,10 +34,16 @@ SOFTWARE.
 #include "platform.h"
 #include "binary.h"
 #include "bitset.h"
+#include "hash.h"
 #include "log.h"
 #include "parameter_type.h"
 #include "power.h"
+#include "span.h"
+#include "static_assert.h"
 #include "type_traits.h"
+#include "private/prefetch.h"
+
+#include <stdint.h>
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -56,6 +62,39 @@ namespace etl
         return 0;
       }
     };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The location of a key in a blocked filter.
+    /// The probes are at (h1 + (i * h2)) modulo the block size. h2 is odd, so
+    /// the probes are all different while there are fewer than the block
+    /// size.
+    //*************************************************************************
+    struct block_probe
+    {
+      size_t   block;
+      uint32_t h1;
+      uint32_t h2;
+    };
+
+    //*************************************************************************
+    /// Spreads the bits of a user hash over all 64 bits, then splits it into
+    /// a block index and the two hashes for the probes.
+    //*************************************************************************
+    inline block_probe make_block_probe(uint64_t hash, size_t number_of_blocks)
+    {
+      hash = etl::private_hash::murmur3_finalise_64(hash);
+
+      block_probe probe;
+
+      // Maps the high half onto the blocks without a division.
+      probe.block = static_cast<size_t>(((hash >> 32U) * number_of_blocks) >> 32U);
+      probe.h1    = static_cast<uint32_t>(hash);
+      probe.h2    = static_cast<uint32_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32U) | 1U;
+
+      return probe;
+    }
+#endif
   } // namespace private_bloom_filter
 
   //***************************************************************************
@@ -183,6 +222,471 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A cache blocked Bloom filter.
+  /// Each key is mapped to one 64 byte block, and all of its probes are within
+  /// that block, so a test costs at most one cache miss. The probes are
+  /// generated from a single hash by double hashing, so any number may be
+  /// configured. Blocking gives a slightly higher false positive rate than an
+  /// unblocked filter of the same width.
+  /// The hash class must define <b>argument_type</b>.
+  ///\tparam Desired_Width    The desired number of bits. Rounded up to a whole
+  /// number of 512 bit blocks.
+  ///\tparam THash            The hash generator class.
+  ///\tparam Number_Of_Probes The number of bits set for each key.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes = 8U>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename THash::argument_type                        argument_type;
+    typedef typename etl::parameter_type<argument_type>::type    parameter_t;
+    typedef private_bloom_filter::block_probe                    block_probe;
+
+    static ETL_CONSTANT size_t Words_Per_Block = 8U;
+    static ETL_CONSTANT size_t Bits_Per_Block  = Words_Per_Block * 64U;
+    static ETL_CONSTANT size_t Batch_Size      = 16U;
+
+  public:
+
+    ETL_STATIC_ASSERT((Number_Of_Probes > 0U) && (Number_Of_Probes <= Bits_Per_Block), "Invalid number of probes");
+
+    static ETL_CONSTANT size_t Number_Of_Blocks = (Desired_Width + Bits_Per_Block - 1U) / Bits_Per_Block;
+
+    enum
+    {
+      WIDTH = Number_Of_Blocks * Bits_Per_Block
+    };
+
+    //***************************************************************************
+    /// Constructor. The filter is empty.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (Number_Of_Blocks * Words_Per_Block); ++i)
+      {
+        words[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const block_probe probe = get_probe(key);
+
+      uint64_t* block = words + (probe.block * Words_Per_Block);
+
+      uint32_t position = probe.h1;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        block[(position / 64U) % Words_Per_Block] |= uint64_t(1U) << (position % 64U);
+        position += probe.h2;
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return exists(get_probe(key));
+    }
+
+    //***************************************************************************
+    /// Tests a span of keys, in batches. The blocks for a batch are prefetched
+    /// before any are tested, so that the cache misses overlap.
+    /// Only the smaller of the two spans is processed.
+    ///\param keys    The keys to test.
+    ///\param results The results, in the same order as the keys.
+    ///\return The number of keys that exist in the filter.
+    //***************************************************************************
+    size_t exists(etl::span<const argument_type> keys, etl::span<bool> results) const
+    {
+      const size_t n = (keys.size() < results.size()) ? keys.size() : results.size();
+
+      size_t found = 0U;
+
+      block_probe probes[Batch_Size];
+
+      for (size_t first = 0U; first < n; first += Batch_Size)
+      {
+        const size_t batch = ((n - first) < Batch_Size) ? (n - first) : Batch_Size;
+
+        for (size_t i = 0U; i < batch; ++i)
+        {
+          probes[i] = get_probe(keys[first + i]);
+          etl::private_prefetch::prefetch(words + (probes[i].block * Words_Per_Block));
+        }
+
+        for (size_t i = 0U; i < batch; ++i)
+        {
+          results[first + i] = exists(probes[i]);
+          found += results[first + i] ? 1U : 0U;
+        }
+      }
+
+      return found;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < (Number_Of_Blocks * Words_Per_Block); ++i)
+      {
+        total += etl::count_bits(words[i]);
+      }
+
+      return total;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the probe for the key.
+    //***************************************************************************
+    static block_probe get_probe(parameter_t key)
+    {
+      return private_bloom_filter::make_block_probe(static_cast<uint64_t>(THash()(key)), Number_Of_Blocks);
+    }
+
+    //***************************************************************************
+    /// Tests the probes, without branching on each.
+    //***************************************************************************
+    bool exists(const block_probe& probe) const
+    {
+      const uint64_t* block = words + (probe.block * Words_Per_Block);
+
+      uint32_t position = probe.h1;
+      uint64_t result   = 1U;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        result &= block[(position / 64U) % Words_Per_Block] >> (position % 64U);
+        position += probe.h2;
+      }
+
+      return (result & 1U) != 0U;
+    }
+
+    /// The Bloom filter flags.
+  #if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    alignas(64) uint64_t words[Number_Of_Blocks * Words_Per_Block];
+  #else
+    uint64_t words[Number_Of_Blocks * Words_Per_Block];
+  #endif
+  };
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Words_Per_Block;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Bits_Per_Block;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Batch_Size;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Number_Of_Blocks;
+
+  //***************************************************************************
+  /// A cache blocked counting Bloom filter, that supports removal of keys.
+  /// Each flag is replaced by a 4 bit counter, so a block of 64 bytes holds
+  /// 128 counters. Counters saturate at 15 and are then never decremented,
+  /// which may leave a key reported as existing after it is removed, but
+  /// never the reverse.
+  /// The hash class must define <b>argument_type</b>.
+  ///\tparam Desired_Counters The desired number of counters. Rounded up to a
+  /// whole number of 128 counter blocks.
+  ///\tparam THash            The hash generator class.
+  ///\tparam Number_Of_Probes The number of counters incremented for each key.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes = 4U>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename THash::argument_type                        argument_type;
+    typedef typename etl::parameter_type<argument_type>::type    parameter_t;
+    typedef private_bloom_filter::block_probe                    block_probe;
+
+    static ETL_CONSTANT size_t Words_Per_Block    = 8U;
+    static ETL_CONSTANT size_t Counters_Per_Word  = 16U;
+    static ETL_CONSTANT size_t Counters_Per_Block = Words_Per_Block * Counters_Per_Word;
+    static ETL_CONSTANT size_t Batch_Size         = 16U;
+    static ETL_CONSTANT uint64_t Counter_Max      = 15U;
+
+  public:
+
+    ETL_STATIC_ASSERT((Number_Of_Probes > 0U) && (Number_Of_Probes <= Counters_Per_Block), "Invalid number of probes");
+
+    static ETL_CONSTANT size_t Number_Of_Blocks = (Desired_Counters + Counters_Per_Block - 1U) / Counters_Per_Block;
+
+    enum
+    {
+      WIDTH = Number_Of_Blocks * Counters_Per_Block
+    };
+
+    //***************************************************************************
+    /// Constructor. The filter is empty.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (Number_Of_Blocks * Words_Per_Block); ++i)
+      {
+        words[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const block_probe probe = get_probe(key);
+
+      uint64_t* block = words + (probe.block * Words_Per_Block);
+
+      uint32_t position = probe.h1;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        uint64_t&    word  = block[(position / Counters_Per_Word) % Words_Per_Block];
+        const size_t shift = (position % Counters_Per_Word) * 4U;
+
+        if (((word >> shift) & Counter_Max) != Counter_Max)
+        {
+          word += uint64_t(1U) << shift;
+        }
+
+        position += probe.h2;
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// The key is only removed if it exists in the filter. Removing a key that
+    /// was never added, but which is a false positive, will cause false
+    /// negatives for other keys.
+    ///\param key The key to remove.
+    ///\return <b>true</b> if the key existed in the filter.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      const block_probe probe = get_probe(key);
+
+      if (!exists(probe))
+      {
+        return false;
+      }
+
+      uint64_t* block = words + (probe.block * Words_Per_Block);
+
+      uint32_t position = probe.h1;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        uint64_t&    word  = block[(position / Counters_Per_Word) % Words_Per_Block];
+        const size_t shift = (position % Counters_Per_Word) * 4U;
+
+        // Saturated counters have lost their true value.
+        if (((word >> shift) & Counter_Max) != Counter_Max)
+        {
+          word -= uint64_t(1U) << shift;
+        }
+
+        position += probe.h2;
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return exists(get_probe(key));
+    }
+
+    //***************************************************************************
+    /// Tests a span of keys, in batches. The blocks for a batch are prefetched
+    /// before any are tested, so that the cache misses overlap.
+    /// Only the smaller of the two spans is processed.
+    ///\param keys    The keys to test.
+    ///\param results The results, in the same order as the keys.
+    ///\return The number of keys that exist in the filter.
+    //***************************************************************************
+    size_t exists(etl::span<const argument_type> keys, etl::span<bool> results) const
+    {
+      const size_t n = (keys.size() < results.size()) ? keys.size() : results.size();
+
+      size_t found = 0U;
+
+      block_probe probes[Batch_Size];
+
+      for (size_t first = 0U; first < n; first += Batch_Size)
+      {
+        const size_t batch = ((n - first) < Batch_Size) ? (n - first) : Batch_Size;
+
+        for (size_t i = 0U; i < batch; ++i)
+        {
+          probes[i] = get_probe(keys[first + i]);
+          etl::private_prefetch::prefetch(words + (probes[i].block * Words_Per_Block));
+        }
+
+        for (size_t i = 0U; i < batch; ++i)
+        {
+          results[first + i] = exists(probes[i]);
+          found += results[first + i] ? 1U : 0U;
+        }
+      }
+
+      return found;
+    }
+
+    //***************************************************************************
+    /// Returns the number of counters in the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of non-zero counters.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < (Number_Of_Blocks * Words_Per_Block); ++i)
+      {
+        // Fold each counter down to its lowest bit.
+        uint64_t word = words[i];
+        word |= word >> 1U;
+        word |= word >> 2U;
+
+        total += etl::count_bits(word & 0x1111111111111111ULL);
+      }
+
+      return total;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the probe for the key.
+    //***************************************************************************
+    static block_probe get_probe(parameter_t key)
+    {
+      return private_bloom_filter::make_block_probe(static_cast<uint64_t>(THash()(key)), Number_Of_Blocks);
+    }
+
+    //***************************************************************************
+    /// Tests that none of the counters for the probes are zero.
+    //***************************************************************************
+    bool exists(const block_probe& probe) const
+    {
+      const uint64_t* block = words + (probe.block * Words_Per_Block);
+
+      uint32_t position = probe.h1;
+      bool     result   = true;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        const uint64_t word = block[(position / Counters_Per_Word) % Words_Per_Block];
+
+        result = result && (((word >> ((position % Counters_Per_Word) * 4U)) & Counter_Max) != 0U);
+        position += probe.h2;
+      }
+
+      return result;
+    }
+
+    /// The Bloom filter counters.
+  #if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    alignas(64) uint64_t words[Number_Of_Blocks * Words_Per_Block];
+  #else
+    uint64_t words[Number_Of_Blocks * Words_Per_Block];
+  #endif
+  };
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Words_Per_Block;
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Counters_Per_Word;
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Counters_Per_Block;
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Batch_Size;
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT uint64_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Counter_Max;
+
+  template <size_t Desired_Counters, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Counters, THash, Number_Of_Probes>::Number_Of_Blocks;
+#endif
 } // namespace etl
 
 #endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "algorithm.h"
+#include "binary.h"
 #include "delegate.h"
 #include "endianness.h"
 #include "error_handler.h"
@@ -43,11 +44,149 @@ SOFTWARE.
 #include "optional.h"
 #include "span.h"
 #include "type_traits.h"
+#include "unaligned_type.h"
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Copies blocks of elements to or from a stream.
+    /// Elements that have a matching unsigned word are byte swapped a word at a
+    /// time, a loop that compilers reduce to bswap/rev or vectorise to
+    /// pshufb/rev when the target allows.
+    //*************************************************************************
+    template <size_t Size>
+    struct swap_word
+    {
+      static ETL_CONSTANT bool value = false;
+    };
+
+    template <>
+    struct swap_word<2U>
+    {
+      static ETL_CONSTANT bool value = true;
+      typedef uint16_t type;
+    };
+
+    template <>
+    struct swap_word<4U>
+    {
+      static ETL_CONSTANT bool value = true;
+      typedef uint32_t type;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct swap_word<8U>
+    {
+      static ETL_CONSTANT bool value = true;
+      typedef uint64_t type;
+    };
+#endif
+
+    //*********************************
+    template <size_t Size, bool Has_Word = swap_word<Size>::value>
+    struct block_copy
+    {
+      static void copy(const char* source, char* destination, size_t n, bool reverse)
+      {
+        if ((Size == 1U) || !reverse)
+        {
+          if (n != 0U)
+          {
+            memcpy(destination, source, n * Size);
+          }
+        }
+        else
+        {
+          for (size_t i = 0U; i < n; ++i)
+          {
+            etl::reverse_copy(source, source + Size, destination);
+            source      += Size;
+            destination += Size;
+          }
+        }
+      }
+    };
+
+    //*********************************
+    template <size_t Size>
+    struct block_copy<Size, true>
+    {
+      static void copy(const char* source, char* destination, size_t n, bool reverse)
+      {
+        typedef typename swap_word<Size>::type word_t;
+
+        if (!reverse)
+        {
+          if (n != 0U)
+          {
+            memcpy(destination, source, n * Size);
+          }
+        }
+        else
+        {
+          for (size_t i = 0U; i < n; ++i)
+          {
+            word_t word;
+            memcpy(&word, source + (i * Size), Size);
+            word = etl::reverse_bytes(word);
+            memcpy(destination + (i * Size), &word, Size);
+          }
+        }
+      }
+    };
+  } // namespace private_byte_stream
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// The number of bytes in the LEB128 varint encoding of a value.
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, size_t>::type varint_size(T value)
+  {
+    size_t size = 1U;
+
+    while (value >= 0x80U)
+    {
+      value >>= 7U;
+      ++size;
+    }
+
+    return size;
+  }
+
+  //***************************************************************************
+  /// Zigzag encodes a signed value, so that values of small magnitude have
+  /// short varint encodings.
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+    zigzag_encode(T value)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    return (value < 0) ? static_cast<unsigned_t>(~(static_cast<unsigned_t>(value) << 1U)) : static_cast<unsigned_t>(static_cast<unsigned_t>(value) << 1U);
+  }
+
+  //***************************************************************************
+  /// Decodes a zigzag encoded value.
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, typename etl::make_signed<T>::type>::type
+    zigzag_decode(T value)
+  {
+    typedef typename etl::make_signed<T>::type signed_t;
+
+    return static_cast<signed_t>(static_cast<T>(value >> 1U) ^ static_cast<T>(T(0U) - static_cast<T>(value & 1U)));
+  }
+#endif
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -175,13 +314,7 @@ namespace etl
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      write_block<sizeof(T)>(reinterpret_cast<const char*>(range.data()), range.size(), stream_endianness != etl::endianness::value());
     }
 
     //***************************************************************************
@@ -206,11 +339,7 @@ namespace etl
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      write_block<sizeof(T)>(reinterpret_cast<const char*>(start), length, stream_endianness != etl::endianness::value());
     }
 
     //***************************************************************************
@@ -229,6 +358,104 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Write a range of etl::unaligned_type to the stream.
+    /// The stored bytes are copied directly if their endianness matches the stream.
+    //***************************************************************************
+    template <typename T, int Endian>
+    void write_unchecked(const etl::span<const etl::unaligned_type<T, Endian> >& range)
+    {
+      write_block<sizeof(T)>(reinterpret_cast<const char*>(range.data()), range.size(), stream_endianness != etl::endian(Endian));
+    }
+
+    //***************************************************************************
+    /// Write a range of etl::unaligned_type to the stream.
+    //***************************************************************************
+    template <typename T, int Endian>
+    bool write(const etl::span<const etl::unaligned_type<T, Endian> >& range)
+    {
+      bool success = (available<T>() >= range.size());
+
+      if (success)
+      {
+        write_unchecked(range);
+      }
+
+      return success;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Write an unsigned value as an LEB128 varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, void>::type write_varint_unchecked(T value)
+    {
+      size_t n = 0U;
+
+      while (value >= 0x80U)
+      {
+        pcurrent[n++] = static_cast<char>((value & 0x7FU) | 0x80U);
+        value >>= 7U;
+      }
+
+      pcurrent[n++] = static_cast<char>(value);
+
+      step(n);
+    }
+
+    //***************************************************************************
+    /// Write an unsigned value as an LEB128 varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, bool>::type write_varint(T value)
+    {
+      bool success = (available_bytes() >= etl::varint_size(value));
+
+      if (success)
+      {
+        write_varint_unchecked(value);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Write a signed value as a zigzag encoded varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, void>::type write_zigzag_unchecked(T value)
+    {
+      write_varint_unchecked(etl::zigzag_encode(value));
+    }
+
+    //***************************************************************************
+    /// Write a signed value as a zigzag encoded varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, bool>::type write_zigzag(T value)
+    {
+      return write_varint(etl::zigzag_encode(value));
+    }
+
+    //***************************************************************************
+    /// Write a range of bytes, prefixed with its length as a varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<sizeof(T) == 1U, bool>::type write_length_delimited(const etl::span<T>& range)
+    {
+      bool success = (available_bytes() >= (etl::varint_size(range.size()) + range.size()));
+
+      if (success)
+      {
+        write_varint_unchecked(range.size());
+        write_unchecked(reinterpret_cast<const char*>(range.data()), range.size());
+      }
+
+      return success;
+    }
+#endif
+
     //***************************************************************************
     /// Skip n items of T, if the total space is available.
     /// Returns <b>true</b> if the skip was possible.
@@ -453,6 +680,26 @@ namespace etl
       pcurrent += n;
     }
 
+    //*********************************
+    template <size_t Size>
+    void write_block(const char* source, size_t n, bool reverse)
+    {
+      private_byte_stream::block_copy<Size>::copy(source, pcurrent, n, reverse);
+
+      if (callback.is_valid())
+      {
+        // The callback is still called once per element.
+        while (n-- != 0U)
+        {
+          step(Size);
+        }
+      }
+      else
+      {
+        pcurrent += (n * Size);
+      }
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
@@ -620,12 +867,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      read_block(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -653,12 +895,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type read_unchecked(T*     start,
                                                                                                                                       size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      read_block(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -679,6 +916,105 @@ namespace etl
       return etl::optional<etl::span<const T> >();
     }
 
+    //***************************************************************************
+    /// Read a range of etl::unaligned_type from the stream.
+    /// The stored bytes are copied directly if their endianness matches the stream.
+    //***************************************************************************
+    template <typename T, int Endian>
+    etl::span<const etl::unaligned_type<T, Endian> > read_unchecked(etl::span<etl::unaligned_type<T, Endian> > range)
+    {
+      private_byte_stream::block_copy<sizeof(T)>::copy(pcurrent, reinterpret_cast<char*>(range.data()), range.size(), stream_endianness != etl::endian(Endian));
+      pcurrent += range.size_bytes();
+
+      return etl::span<const etl::unaligned_type<T, Endian> >(range.begin(), range.end());
+    }
+
+    //***************************************************************************
+    /// Read a range of etl::unaligned_type from the stream.
+    //***************************************************************************
+    template <typename T, int Endian>
+    etl::optional<etl::span<const etl::unaligned_type<T, Endian> > > read(etl::span<etl::unaligned_type<T, Endian> > range)
+    {
+      // Do we have enough room?
+      if (available<T>() >= range.size())
+      {
+        return etl::optional<etl::span<const etl::unaligned_type<T, Endian> > >(read_unchecked(range));
+      }
+
+      return etl::optional<etl::span<const etl::unaligned_type<T, Endian> > >();
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Read an LEB128 varint.
+    /// Returns an empty optional, without consuming the stream, if the varint is
+    /// truncated, longer than 10 bytes, or does not fit in T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, etl::optional<T> >::type read_varint()
+    {
+      etl::optional<T> result;
+
+      uint64_t     value  = 0U;
+      const size_t length = decode_varint(value);
+
+      if ((length != 0U) && (value <= etl::integral_limits<T>::max))
+      {
+        result = static_cast<T>(value);
+        pcurrent += length;
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Read a zigzag encoded varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, etl::optional<T> >::type read_zigzag()
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      etl::optional<T> result;
+
+      etl::optional<unsigned_t> value = read_varint<unsigned_t>();
+
+      if (value.has_value())
+      {
+        result = etl::zigzag_decode(value.value());
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Read a range of bytes, prefixed with its length as a varint.
+    /// Returns an empty optional, without consuming the stream, if the range is
+    /// truncated.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<sizeof(T) == 1U, etl::optional<etl::span<const T> > >::type read_length_delimited()
+    {
+      etl::optional<etl::span<const T> > result;
+
+      const char* const start = pcurrent;
+
+      etl::optional<size_t> length = read_varint<size_t>();
+
+      if (length.has_value())
+      {
+        result = read<T>(length.value());
+
+        if (!result.has_value())
+        {
+          pcurrent = start;
+        }
+      }
+
+      return result;
+    }
+#endif
+
     //***************************************************************************
     /// Skip n items of T, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -829,6 +1165,102 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    template <typename T>
+    void read_block(T* destination, size_t n)
+    {
+      private_byte_stream::block_copy<sizeof(T)>::copy(pcurrent, reinterpret_cast<char*>(destination), n, stream_endianness != etl::endianness::value());
+      pcurrent += (n * sizeof(T));
+    }
+
+    //*********************************
+    void read_block(bool* destination, size_t n)
+    {
+      // Any non-zero byte is true, so bools are converted individually.
+      while (n-- != 0U)
+      {
+        *destination++ = from_bytes<bool>();
+      }
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*********************************
+    /// Decodes the varint at the current position.
+    /// Returns its length, or 0 if it is invalid.
+    /// Varints of 2 to 8 bytes are decoded from a single word load, using the
+    /// first clear continuation bit to find the end.
+    //*********************************
+    size_t decode_varint(uint64_t& value) const
+    {
+      const unsigned char* p     = reinterpret_cast<const unsigned char*>(pcurrent);
+      const size_t         avail = available_bytes();
+
+      // Single byte values are the most common.
+      if ((avail != 0U) && (p[0] < 0x80U))
+      {
+        value = p[0];
+
+        return 1U;
+      }
+
+      if (avail >= sizeof(uint64_t))
+      {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+
+        if (etl::endianness::value() == etl::endian::big)
+        {
+          word = etl::reverse_bytes(word);
+        }
+
+        const uint64_t stops = ~word & UINT64_C(0x8080808080808080);
+
+        if (stops != 0U)
+        {
+          // Keep the bytes up to, and including, the first stop byte.
+          const uint64_t last = stops & (UINT64_C(0) - stops);
+          const uint64_t keep = last | (last - 1U);
+          word &= keep & UINT64_C(0x7F7F7F7F7F7F7F7F);
+
+          // Pack the 7 bit groups together.
+          word = ((word & UINT64_C(0x7F007F007F007F00)) >> 1U) | (word & UINT64_C(0x007F007F007F007F));
+          word = ((word & UINT64_C(0x3FFF00003FFF0000)) >> 2U) | (word & UINT64_C(0x00003FFF00003FFF));
+          word = ((word & UINT64_C(0x0FFFFFFF00000000)) >> 4U) | (word & UINT64_C(0x000000000FFFFFFF));
+
+          value = word;
+
+          // One bit per kept byte, summed into the top byte.
+          return static_cast<size_t>(((keep & UINT64_C(0x0101010101010101)) * UINT64_C(0x0101010101010101)) >> 56U);
+        }
+      }
+
+      // Near the end of the stream, or longer than 8 bytes.
+      const size_t max_length = etl::min(avail, size_t(10U));
+
+      value = 0U;
+
+      for (size_t i = 0U; i < max_length; ++i)
+      {
+        const uint64_t byte = p[i];
+
+        // The 10th byte may only hold the top bit of a 64 bit value.
+        if ((i == 9U) && (byte > 1U))
+        {
+          break;
+        }
+
+        value |= (byte & 0x7FU) << (7U * i);
+
+        if (byte < 0x80U)
+        {
+          return i + 1U;
+        }
+      }
+
+      return 0U;
+    }
+#endif
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
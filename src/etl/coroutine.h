@@ -0,0 +1,897 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COROUTINE_INCLUDED
+#define ETL_COROUTINE_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP20 && defined(__cpp_impl_coroutine) && ETL_HAS_ATOMIC
+
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "ipool.h"
+#include "nullptr.h"
+#include "optional.h"
+#include "power.h"
+#include "queue_spsc_atomic.h"
+#include "task.h"
+#include "timer.h"
+#include "utility.h"
+#include "private/bounded_mpmc_queue.h"
+
+#include <coroutine>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup coroutine coroutine
+/// C++20 coroutine tasks, with frames allocated from an etl::ipool, resumed
+/// by an etl::task that can be run by etl::scheduler.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for coroutine exceptions.
+  ///\ingroup coroutine
+  //***************************************************************************
+  class coroutine_exception : public etl::exception
+  {
+  public:
+
+    coroutine_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception raised when a coroutine does not handle an exception.
+  ///\ingroup coroutine
+  //***************************************************************************
+  class coroutine_unhandled_exception : public coroutine_exception
+  {
+  public:
+
+    coroutine_unhandled_exception(string_type file_name_, numeric_type line_number_)
+      : coroutine_exception(ETL_ERROR_TEXT("coroutine:unhandled exception", ETL_COROUTINE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception raised when the result of an invalid co_task is taken.
+  ///\ingroup coroutine
+  //***************************************************************************
+  class coroutine_invalid_task_exception : public coroutine_exception
+  {
+  public:
+
+    coroutine_invalid_task_exception(string_type file_name_, numeric_type line_number_)
+      : coroutine_exception(ETL_ERROR_TEXT("coroutine:invalid task", ETL_COROUTINE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception raised when a coroutine cannot be scheduled, as the
+  /// runner's ready queue is full.
+  ///\ingroup coroutine
+  //***************************************************************************
+  class coroutine_runner_full_exception : public coroutine_exception
+  {
+  public:
+
+    coroutine_runner_full_exception(string_type file_name_, numeric_type line_number_)
+      : coroutine_exception(ETL_ERROR_TEXT("coroutine:runner full", ETL_COROUTINE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_coroutine
+  {
+    /// Each frame is preceded by a pointer to the pool it came from.
+    static ETL_CONSTEXPR size_t Frame_Header_Size = alignof(max_align_t);
+
+    //*************************************************************************
+    /// The pool used when the coroutine does not name one.
+    //*************************************************************************
+    inline etl::ipool*& default_frame_pool()
+    {
+      static etl::ipool* p_pool = ETL_NULLPTR;
+
+      return p_pool;
+    }
+
+    //*************************************************************************
+    /// Allocates a frame from a pool.
+    /// Returns a null pointer if the pool is full or its items are too small,
+    /// which makes the coroutine invalid.
+    //*************************************************************************
+    inline void* allocate_frame(etl::ipool* p_pool, size_t size) noexcept
+    {
+      if ((p_pool == ETL_NULLPTR) || p_pool->full() || ((size + Frame_Header_Size) > p_pool->max_item_size()))
+      {
+        return ETL_NULLPTR;
+      }
+
+      char* p_block = p_pool->allocate<char>();
+
+      memcpy(p_block, &p_pool, sizeof(p_pool));
+
+      return p_block + Frame_Header_Size;
+    }
+
+    //*************************************************************************
+    /// Returns a frame to the pool it came from.
+    //*************************************************************************
+    inline void release_frame(void* p_frame) noexcept
+    {
+      char*       p_block = static_cast<char*>(p_frame) - Frame_Header_Size;
+      etl::ipool* p_pool;
+
+      memcpy(&p_pool, p_block, sizeof(p_pool));
+
+      p_pool->release(p_block);
+    }
+
+    //*************************************************************************
+    /// Resumes the awaiting coroutine, if any, when a coroutine completes.
+    //*************************************************************************
+    struct final_awaiter
+    {
+      bool await_ready() const noexcept
+      {
+        return false;
+      }
+
+      template <typename TPromise>
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+      {
+        std::coroutine_handle<> continuation = handle.promise().continuation;
+
+        return continuation ? continuation : std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The parts of a promise that do not depend on the result type.
+    //*************************************************************************
+    class promise_base
+    {
+    public:
+
+      //***********************************
+      /// Allocates the frame from the default pool.
+      //***********************************
+      static void* operator new(size_t size) noexcept
+      {
+        return allocate_frame(default_frame_pool(), size);
+      }
+
+      //***********************************
+      /// Returns the frame to its pool.
+      //***********************************
+      static void operator delete(void* p_frame) noexcept
+      {
+        release_frame(p_frame);
+      }
+
+      //***********************************
+      /// Coroutines do not start until they are awaited or started by a
+      /// runner.
+      //***********************************
+      std::suspend_always initial_suspend() const noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //***********************************
+      final_awaiter final_suspend() const noexcept
+      {
+        return final_awaiter();
+      }
+
+      //***********************************
+      void unhandled_exception()
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::coroutine_unhandled_exception));
+      }
+
+      std::coroutine_handle<> continuation; ///< The coroutine awaiting this one.
+    };
+
+    //*************************************************************************
+    /// Holds the result of a coroutine.
+    //*************************************************************************
+    template <typename T>
+    class promise_result
+    {
+    public:
+
+      template <typename U>
+      void return_value(U&& value)
+      {
+        result.emplace(etl::forward<U>(value));
+      }
+
+      T take_result()
+      {
+        return etl::move(*result);
+      }
+
+      etl::optional<T> result;
+    };
+
+    //*************************************************************************
+    /// A coroutine without a result.
+    //*************************************************************************
+    template <>
+    class promise_result<void>
+    {
+    public:
+
+      void return_void() const noexcept
+      {
+      }
+
+      void take_result() const noexcept
+      {
+      }
+    };
+
+    template <typename T, typename... TArgs>
+    class pool_promise;
+  } // namespace private_coroutine
+
+  //***************************************************************************
+  /// Sets the pool that coroutine frames are allocated from, when the
+  /// coroutine does not take an etl::ipool& as its first parameter.
+  /// The pool's items must be large enough for the frame and a pointer, and
+  /// aligned as for max_align_t.
+  ///\ingroup coroutine
+  //***************************************************************************
+  inline void set_coroutine_frame_pool(etl::ipool& pool)
+  {
+    private_coroutine::default_frame_pool() = &pool;
+  }
+
+  //***************************************************************************
+  /// A lazily started coroutine, with a result of type T.
+  /// Its frame is allocated from an etl::ipool. If the allocation fails the
+  /// co_task is not valid.
+  /// A co_task may be awaited by another coroutine, or started by a runner.
+  /// The frame is destroyed with the co_task.
+  ///\ingroup coroutine
+  //***************************************************************************
+  template <typename T = void>
+  class co_task
+  {
+  public:
+
+    class promise_type
+      : public private_coroutine::promise_base
+      , public private_coroutine::promise_result<T>
+    {
+    public:
+
+      co_task get_return_object() noexcept
+      {
+        return co_task(std::coroutine_handle<promise_type>::from_promise(*this), *this);
+      }
+
+      static co_task get_return_object_on_allocation_failure() noexcept
+      {
+        return co_task();
+      }
+    };
+
+    //*******************************************
+    /// Constructs an invalid co_task.
+    //*******************************************
+    co_task() noexcept
+      : handle()
+      , p_promise(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    co_task(co_task&& other) noexcept
+      : handle(other.handle)
+      , p_promise(other.p_promise)
+    {
+      other.handle    = std::coroutine_handle<>();
+      other.p_promise = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    co_task& operator=(co_task&& other) noexcept
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle          = other.handle;
+        p_promise       = other.p_promise;
+        other.handle    = std::coroutine_handle<>();
+        other.p_promise = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+
+    co_task(const co_task&)            = delete;
+    co_task& operator=(const co_task&) = delete;
+
+    //*******************************************
+    ~co_task()
+    {
+      destroy();
+    }
+
+    //*******************************************
+    /// Checks if the coroutine frame was allocated.
+    //*******************************************
+    bool valid() const noexcept
+    {
+      return static_cast<bool>(handle);
+    }
+
+    //*******************************************
+    /// Checks if the coroutine has completed.
+    //*******************************************
+    bool done() const noexcept
+    {
+      return !handle || handle.done();
+    }
+
+    //*******************************************
+    /// Gets the coroutine handle.
+    //*******************************************
+    std::coroutine_handle<> get_handle() const noexcept
+    {
+      return handle;
+    }
+
+    //*******************************************
+    /// Takes the result of a completed coroutine.
+    /// The co_task must be valid.
+    //*******************************************
+    T take_result()
+    {
+      ETL_ASSERT(p_promise != ETL_NULLPTR, ETL_ERROR(etl::coroutine_invalid_task_exception));
+
+      return p_promise->take_result();
+    }
+
+    //*******************************************
+    /// Awaiting a co_task starts it, and resumes the awaiting coroutine when
+    /// it completes.
+    /// An invalid co_task does not suspend the awaiting coroutine, and
+    /// raises an etl::coroutine_invalid_task_exception, as it has no result.
+    //*******************************************
+    class awaiter
+    {
+    public:
+
+      awaiter(std::coroutine_handle<> handle_, promise_type* p_promise_) noexcept
+        : handle(handle_)
+        , p_promise(p_promise_)
+      {
+      }
+
+      bool await_ready() const noexcept
+      {
+        return !handle || handle.done();
+      }
+
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+      {
+        p_promise->continuation = awaiting;
+
+        return handle;
+      }
+
+      T await_resume()
+      {
+        ETL_ASSERT(p_promise != ETL_NULLPTR, ETL_ERROR(etl::coroutine_invalid_task_exception));
+
+        return p_promise->take_result();
+      }
+
+    private:
+
+      std::coroutine_handle<> handle;
+      promise_type*           p_promise;
+    };
+
+    //*******************************************
+    awaiter operator co_await() const noexcept
+    {
+      return awaiter(handle, p_promise);
+    }
+
+  private:
+
+    template <typename U, typename... TArgs>
+    friend class private_coroutine::pool_promise;
+
+    //*******************************************
+    co_task(std::coroutine_handle<> handle_, promise_type& promise_) noexcept
+      : handle(handle_)
+      , p_promise(&promise_)
+    {
+    }
+
+    //*******************************************
+    void destroy() noexcept
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle    = std::coroutine_handle<>();
+        p_promise = ETL_NULLPTR;
+      }
+    }
+
+    std::coroutine_handle<> handle;    ///< The coroutine's frame.
+    promise_type*           p_promise; ///< The coroutine's promise, which may be a pool_promise.
+  };
+
+  namespace private_coroutine
+  {
+    //*************************************************************************
+    /// The promise of a co_task coroutine that takes an etl::ipool& as its
+    /// first parameter. The frame is allocated from that pool.
+    /// The allocation and deallocation functions are not templates, so that
+    /// they are seen to match.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    class pool_promise : public etl::co_task<T>::promise_type
+    {
+    public:
+
+      //***********************************
+      /// Allocates the frame from the pool passed as the first parameter.
+      //***********************************
+      static void* operator new(size_t size, etl::ipool& pool, TArgs&...) noexcept
+      {
+        return allocate_frame(&pool, size);
+      }
+
+      //***********************************
+      /// Returns the frame to its pool.
+      //***********************************
+      static void operator delete(void* p_frame) noexcept
+      {
+        release_frame(p_frame);
+      }
+
+      //***********************************
+      /// Matches the allocation function.
+      //***********************************
+      static void operator delete(void* p_frame, etl::ipool&, TArgs&...) noexcept
+      {
+        release_frame(p_frame);
+      }
+
+      //***********************************
+      etl::co_task<T> get_return_object() noexcept
+      {
+        return etl::co_task<T>(std::coroutine_handle<pool_promise>::from_promise(*this), *this);
+      }
+    };
+  } // namespace private_coroutine
+
+  //***************************************************************************
+  /// The interface for a coroutine runner.
+  /// A runner is an etl::task, so it can be run by etl::scheduler. Each call
+  /// to task_process_work() resumes one ready coroutine.
+  ///\ingroup coroutine
+  //***************************************************************************
+  class ico_runner : public etl::task
+  {
+  public:
+
+    //*******************************************
+    /// Queues a coroutine to be resumed.
+    /// May be called from interrupts or other threads.
+    ///\return <b>false</b> if the ready queue is full.
+    //*******************************************
+    virtual bool schedule(std::coroutine_handle<> handle) = 0;
+
+    //*******************************************
+    /// Starts a co_task.
+    //*******************************************
+    template <typename T>
+    bool start(co_task<T>& task_)
+    {
+      return task_.valid() && !task_.done() && schedule(task_.get_handle());
+    }
+
+    //*******************************************
+    /// Awaiting yield() lets other ready coroutines run first.
+    //*******************************************
+    class yield_awaiter
+    {
+    public:
+
+      explicit yield_awaiter(ico_runner& runner_) noexcept
+        : p_runner(&runner_)
+      {
+      }
+
+      bool await_ready() const noexcept
+      {
+        return false;
+      }
+
+      bool await_suspend(std::coroutine_handle<> handle)
+      {
+        return p_runner->schedule(handle);
+      }
+
+      void await_resume() const noexcept
+      {
+      }
+
+    private:
+
+      ico_runner* p_runner;
+    };
+
+    //*******************************************
+    yield_awaiter yield()
+    {
+      return yield_awaiter(*this);
+    }
+
+  protected:
+
+    //*******************************************
+    ico_runner(etl::task_priority_t priority)
+      : etl::task(priority)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A coroutine runner with a fixed capacity ready queue.
+  ///\tparam Max_Ready The number of coroutines that may be ready at once.
+  ///\ingroup coroutine
+  //***************************************************************************
+  template <size_t Max_Ready>
+  class co_runner : public ico_runner
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit co_runner(etl::task_priority_t priority = 0U)
+      : ico_runner(priority)
+    {
+      ready_count.store(0U);
+    }
+
+    //*******************************************
+    /// Queues a coroutine to be resumed.
+    //*******************************************
+    bool schedule(std::coroutine_handle<> handle) ETL_OVERRIDE
+    {
+      if (!ready.push(handle.address()))
+      {
+        return false;
+      }
+
+      ready_count.fetch_add(1U);
+
+      return true;
+    }
+
+    //*******************************************
+    /// Returns the number of ready coroutines.
+    //*******************************************
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return ready_count.load();
+    }
+
+    //*******************************************
+    /// Resumes the next ready coroutine.
+    //*******************************************
+    void task_process_work() ETL_OVERRIDE
+    {
+      void* p_frame;
+
+      if (ready.pop(p_frame))
+      {
+        ready_count.fetch_sub(1U);
+        std::coroutine_handle<>::from_address(p_frame).resume();
+      }
+    }
+
+  private:
+
+    typedef private_bounded_mpmc_queue::bounded_mpmc_queue<void*, etl::power_of_2_round_up<Max_Ready>::value> ready_queue_t;
+
+    ready_queue_t         ready;
+    etl::atomic<uint32_t> ready_count;
+  };
+
+  //***************************************************************************
+  /// Suspends a coroutine for a period, using a callback timer.
+  /// The timer's callback schedules the coroutine on the runner, so the timer
+  /// may be ticked from an interrupt.
+  /// TTimer is any of the etl::callback_timer classes.
+  /// co_await returns <b>false</b> if no timer was free, in which case the
+  /// coroutine was not suspended.
+  /// The timer repeats until the coroutine has been scheduled, so if the
+  /// runner's ready queue is full when it expires, it tries again a period
+  /// later.
+  ///\ingroup coroutine
+  //***************************************************************************
+  template <typename TTimer>
+  class co_timer_await
+  {
+  public:
+
+    //*******************************************
+    co_timer_await(TTimer& timer_, ico_runner& runner_, uint32_t period_)
+      : timer(timer_)
+      , runner(runner_)
+      , period(period_)
+      , id(etl::timer::id::NO_TIMER)
+      , scheduled(false)
+    {
+    }
+
+    //*******************************************
+    bool await_ready() const noexcept
+    {
+      return period == 0U;
+    }
+
+    //*******************************************
+    bool await_suspend(std::coroutine_handle<> handle_)
+    {
+      handle    = handle_;
+      scheduled = false;
+      callback  = callback_type::template create<co_timer_await, &co_timer_await::on_expired>(*this);
+      id        = timer.register_timer(callback, period, true);
+
+      if (id == etl::timer::id::NO_TIMER)
+      {
+        return false;
+      }
+
+      timer.start(id);
+
+      return true;
+    }
+
+    //*******************************************
+    bool await_resume()
+    {
+      if (id == etl::timer::id::NO_TIMER)
+      {
+        return period == 0U;
+      }
+
+      timer.unregister_timer(id);
+
+      return true;
+    }
+
+  private:
+
+    typedef typename TTimer::callback_type callback_type;
+
+    //*******************************************
+    /// Schedules the coroutine, unless it has already been scheduled.
+    /// The timer is not stopped here, as the callback may be called from
+    /// within the timer's tick().
+    //*******************************************
+    void on_expired()
+    {
+      if (!scheduled)
+      {
+        scheduled = runner.schedule(handle);
+      }
+    }
+
+    TTimer&                 timer;
+    ico_runner&             runner;
+    uint32_t                period;
+    etl::timer::id::type    id;
+    callback_type           callback;
+    std::coroutine_handle<> handle;
+    bool                    scheduled; ///< Whether the coroutine has been scheduled. Only used by the callback once the timer is started.
+  };
+
+  //***************************************************************************
+  /// A single producer, single consumer queue that a coroutine can await.
+  /// push() may be called from an interrupt or another thread, and resumes
+  /// the coroutine waiting in pop(), through the runner.
+  ///\ingroup coroutine
+  //***************************************************************************
+  template <typename T, size_t Size>
+  class co_queue_spsc
+  {
+  public:
+
+    //*******************************************
+    explicit co_queue_spsc(ico_runner& runner_)
+      : runner(runner_)
+    {
+      p_waiting.store(ETL_NULLPTR);
+    }
+
+    //*******************************************
+    /// Pushes a value, and wakes the waiting coroutine.
+    /// If the runner's ready queue is full, the value is still pushed, the
+    /// coroutine stays waiting until the next push(), and an
+    /// etl::coroutine_runner_full_exception is raised.
+    ///\return <b>false</b> if the queue is full.
+    //*******************************************
+    bool push(const T& value)
+    {
+      if (!queue.push(value))
+      {
+        return false;
+      }
+
+      void* p_frame = p_waiting.exchange(ETL_NULLPTR);
+
+      if ((p_frame != ETL_NULLPTR) && !runner.schedule(std::coroutine_handle<>::from_address(p_frame)))
+      {
+        // The coroutine is suspended, so only the producer can touch the registration.
+        p_waiting.store(p_frame);
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::coroutine_runner_full_exception));
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Pops a value without waiting.
+    //*******************************************
+    bool try_pop(T& value)
+    {
+      return queue.pop(value);
+    }
+
+    //*******************************************
+    /// Awaiting pop() returns the next value, suspending until there is one.
+    //*******************************************
+    class pop_awaiter
+    {
+    public:
+
+      explicit pop_awaiter(co_queue_spsc& owner_)
+        : p_owner(&owner_)
+      {
+      }
+
+      bool await_ready()
+      {
+        T item;
+
+        if (p_owner->queue.pop(item))
+        {
+          value.emplace(etl::move(item));
+          return true;
+        }
+
+        return false;
+      }
+
+      bool await_suspend(std::coroutine_handle<> handle)
+      {
+        co_queue_spsc* p_queue = p_owner;
+
+        p_queue->p_waiting.store(handle.address());
+
+        // A value may have been pushed before the coroutine was registered.
+        if (!p_queue->queue.empty())
+        {
+          // If the producer has not taken the registration, do not suspend.
+          return p_queue->p_waiting.exchange(ETL_NULLPTR) == ETL_NULLPTR;
+        }
+
+        return true;
+      }
+
+      T await_resume()
+      {
+        if (!value.has_value())
+        {
+          T item = T();
+          p_owner->queue.pop(item);
+
+          return item;
+        }
+
+        return etl::move(*value);
+      }
+
+    private:
+
+      co_queue_spsc*   p_owner;
+      etl::optional<T> value;
+    };
+
+    //*******************************************
+    pop_awaiter pop()
+    {
+      return pop_awaiter(*this);
+    }
+
+    //*******************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+  private:
+
+    etl::queue_spsc_atomic<T, Size> queue;
+    ico_runner&                     runner;
+    etl::atomic<void*>              p_waiting; ///< The frame of the coroutine waiting in pop().
+  };
+} // namespace etl
+
+namespace std
+{
+  //***************************************************************************
+  /// co_task coroutines that take an etl::ipool& as their first parameter
+  /// allocate their frames from it.
+  //***************************************************************************
+  template <typename T, typename... TArgs>
+  struct coroutine_traits<etl::co_task<T>, etl::ipool&, TArgs...>
+  {
+    typedef etl::private_coroutine::pool_promise<T, TArgs...> promise_type;
+  };
+} // namespace std
+
+#endif
+
+#endif
@@ -32,8 +32,12 @@ SOFTWARE.
 #define ETL_COVARIANCE_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
+#include "error_handler.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/pairwise_sum.h"
 
 #include <stdint.h>
 
@@ -152,6 +156,25 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a block of pairs of values, summed pairwise.
+    /// values2 must be at least as long as values1.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits etl::span_size_mismatch if it
+    /// is shorter. Otherwise only the pairs present in both are added.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      ETL_ASSERT(values2.size() >= values1.size(), ETL_ERROR(etl::span_size_mismatch));
+
+      const size_t length = etl::min(values1.size(), values2.size());
+
+      inner_product += private_statistics::pairwise_sum<calc_t>(private_statistics::product_term<TInput, calc_t>(values1.data(), values2.data()), 0U, length);
+      sum1 += private_statistics::pairwise_sum<calc_t>(private_statistics::value_term<TInput, calc_t>(values1.data()), 0U, length);
+      sum2 += private_statistics::pairwise_sum<calc_t>(private_statistics::value_term<TInput, calc_t>(values2.data()), 0U, length);
+      counter += uint32_t(length);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -171,6 +194,28 @@ namespace etl
       add(first1, last1, first2);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a block of pairs of values.
+    //*********************************
+    void operator()(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      add(values1, values2);
+    }
+
+    //*********************************
+    /// Merges the values added to another covariance.
+    /// Partial results, from separate blocks or threads, may be combined.
+    //*********************************
+    void merge(const covariance& other)
+    {
+      inner_product += other.inner_product;
+      sum1 += other.sum1;
+      sum2 += other.sum2;
+      counter += other.counter;
+      recalculate = true;
+    }
+
     //*********************************
     /// Get the covariance.
     //*********************************
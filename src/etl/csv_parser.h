@@ -0,0 +1,494 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CSV_PARSER_INCLUDED
+#define ETL_CSV_PARSER_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "memory.h"
+#include "string_view.h"
+#include "tokenizer.h"
+
+#include <stddef.h>
+
+///\defgroup csv_parser csv_parser
+/// Incremental parsers for delimited records, such as CSV and key=value lists.
+/// Input may be fed in arbitrary chunks, as received from a UART or socket.
+/// Fields that lie entirely within a chunk are returned as views of that chunk
+/// without copying. Only a field that straddles two chunks is assembled in the
+/// parser's internal buffer.
+/// The parsers do not implement RFC 4180 quoting. Double quotes are ordinary
+/// characters, so a quoted field that contains a delimiter is split at it,
+/// and the quotes are returned as part of the field text.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for the csv parsers.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  class csv_parser_exception : public etl::exception
+  {
+  public:
+
+    csv_parser_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A field that straddles chunks is longer than the internal buffer.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  class csv_parser_field_too_long : public etl::csv_parser_exception
+  {
+  public:
+
+    csv_parser_field_too_long(string_type file_name_, numeric_type line_number_)
+      : etl::csv_parser_exception(ETL_ERROR_TEXT("csv_parser:too long", ETL_CSV_PARSER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A new chunk was fed before the previous one was consumed.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  class csv_parser_chunk_not_consumed : public etl::csv_parser_exception
+  {
+  public:
+
+    csv_parser_chunk_not_consumed(string_type file_name_, numeric_type line_number_)
+      : etl::csv_parser_exception(ETL_ERROR_TEXT("csv_parser:not consumed", ETL_CSV_PARSER_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A field returned by the csv parser.
+  /// 'text' is valid until the next call to the parser.
+  /// 'text' is exactly the characters between delimiters. Quotes are not
+  /// removed or unescaped.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  struct csv_field
+  {
+    etl::string_view text;
+    size_t           index;
+    bool             is_end_of_record;
+  };
+
+  //***************************************************************************
+  /// A key/value pair returned by the key/value parser.
+  /// 'key' and 'value' are valid until the next call to the parser.
+  /// If the field has no separator then 'value' is empty.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  struct key_value_field
+  {
+    etl::string_view key;
+    etl::string_view value;
+    size_t           index;
+    bool             is_end_of_record;
+  };
+
+  //***************************************************************************
+  /// Incremental parser for delimited fields and records.
+  ///\note Quoting is not interpreted, so this is not an RFC 4180 parser.
+  /// Every delimiter splits a field, even between double quotes.
+  /// Empty records, such as the '\n' of a "\r\n" pair, are skipped.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  class icsv_parser
+  {
+  public:
+
+    //*************************************************************************
+    /// Supplies the next chunk of input.
+    /// The chunk must remain valid until next() returns <b>false</b>.
+    //*************************************************************************
+    void feed(const etl::string_view& chunk)
+    {
+      ETL_ASSERT(p_next == p_end, ETL_ERROR(csv_parser_chunk_not_consumed));
+
+      p_next = chunk.data();
+      p_end  = chunk.data() + chunk.size();
+    }
+
+    //*************************************************************************
+    /// Supplies the next chunk of input.
+    /// The chunk must remain valid until next() returns <b>false</b>.
+    //*************************************************************************
+    void feed(const char* data, size_t length)
+    {
+      feed(etl::string_view(data, length));
+    }
+
+    //*************************************************************************
+    /// Gets the next complete field.
+    /// Returns <b>false</b> when the current chunk is exhausted. Any partial
+    /// field at the end of the chunk is retained for the next chunk.
+    /// Quotes are not interpreted. See icsv_parser.
+    //*************************************************************************
+    bool next(etl::csv_field& field)
+    {
+      while (p_next != p_end)
+      {
+        const char* p_delimiter = all_delimiters.find_first_in(p_next, p_end);
+
+        if (p_delimiter == p_end)
+        {
+          // The field continues into the next chunk.
+          append_pending(p_next, p_end);
+          p_next = p_end;
+        }
+        else
+        {
+          const bool is_end_of_record = record_delimiters.contains(*p_delimiter);
+
+          etl::string_view text;
+
+          if (pending_size == 0U)
+          {
+            text = etl::string_view(p_next, static_cast<size_t>(p_delimiter - p_next));
+          }
+          else
+          {
+            append_pending(p_next, p_delimiter);
+            text         = etl::string_view(p_buffer, pending_size);
+            pending_size = 0U;
+          }
+
+          p_next = p_delimiter + 1;
+
+          // Skip empty records.
+          if (!(is_end_of_record && (field_index == 0U) && text.empty()))
+          {
+            field.text             = text;
+            field.index            = field_index;
+            field.is_end_of_record = is_end_of_record;
+
+            field_index = is_end_of_record ? 0U : field_index + 1U;
+
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Signals the end of the input.
+    /// Returns the last field if the input did not end with a record delimiter.
+    //*************************************************************************
+    bool flush(etl::csv_field& field)
+    {
+      if (next(field))
+      {
+        return true;
+      }
+
+      if ((pending_size != 0U) || (field_index != 0U))
+      {
+        field.text             = etl::string_view(p_buffer, pending_size);
+        field.index            = field_index;
+        field.is_end_of_record = true;
+
+        pending_size = 0U;
+        field_index  = 0U;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Discards any unread and partial input.
+    //*************************************************************************
+    void clear()
+    {
+      p_next       = ETL_NULLPTR;
+      p_end        = ETL_NULLPTR;
+      pending_size = 0U;
+      field_index  = 0U;
+    }
+
+    //*************************************************************************
+    /// The maximum length of a field that straddles chunks.
+    //*************************************************************************
+    size_t max_field_size() const
+    {
+      return buffer_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icsv_parser(char* p_buffer_, size_t buffer_size_, const char* field_delimiters_, const char* record_delimiters_)
+      : all_delimiters(field_delimiters_)
+      , record_delimiters(record_delimiters_)
+      , p_next(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+      , p_buffer(p_buffer_)
+      , buffer_size(buffer_size_)
+      , pending_size(0U)
+      , field_index(0U)
+    {
+      while ((record_delimiters_ != ETL_NULLPTR) && (*record_delimiters_ != 0))
+      {
+        all_delimiters.add(*record_delimiters_++);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Appends a partial field to the internal buffer.
+    //*************************************************************************
+    void append_pending(const char* first, const char* last)
+    {
+      size_t length = static_cast<size_t>(last - first);
+
+      if (length > (buffer_size - pending_size))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(csv_parser_field_too_long));
+        length = buffer_size - pending_size;
+      }
+
+      etl::mem_copy(first, length, p_buffer + pending_size);
+      pending_size += length;
+    }
+
+    // Disable copy construction and assignment.
+    icsv_parser(const icsv_parser&) ETL_DELETE;
+    icsv_parser& operator=(const icsv_parser&) ETL_DELETE;
+
+    etl::delimiter_set all_delimiters;
+    etl::delimiter_set record_delimiters;
+    const char*        p_next;
+    const char*        p_end;
+    char*              p_buffer;
+    size_t             buffer_size;
+    size_t             pending_size;
+    size_t             field_index;
+  };
+
+  //***************************************************************************
+  /// Incremental parser for delimited fields and records.
+  ///\tparam Max_Field_Size The maximum length of a field that straddles chunks.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  template <size_t Max_Field_Size>
+  class csv_parser : public etl::icsv_parser
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Field_Size > 0U, "Max_Field_Size must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_FIELD_SIZE = Max_Field_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Defaults to comma separated fields and line based records.
+    /// Quoted fields are not supported. See icsv_parser.
+    //*************************************************************************
+    csv_parser(const char* field_delimiters_ = ",", const char* record_delimiters_ = "\r\n")
+      : icsv_parser(buffer, Max_Field_Size, field_delimiters_, record_delimiters_)
+    {
+    }
+
+  private:
+
+    char buffer[Max_Field_Size];
+  };
+
+  template <size_t Max_Field_Size>
+  ETL_CONSTANT size_t csv_parser<Max_Field_Size>::MAX_FIELD_SIZE;
+
+  //***************************************************************************
+  /// Incremental parser for key=value fields.
+  /// Each field is split at the first separator character.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  class ikey_value_parser
+  {
+  public:
+
+    //*************************************************************************
+    /// Supplies the next chunk of input.
+    //*************************************************************************
+    void feed(const etl::string_view& chunk)
+    {
+      parser.feed(chunk);
+    }
+
+    //*************************************************************************
+    /// Supplies the next chunk of input.
+    //*************************************************************************
+    void feed(const char* data, size_t length)
+    {
+      parser.feed(data, length);
+    }
+
+    //*************************************************************************
+    /// Gets the next complete key/value pair.
+    /// Returns <b>false</b> when the current chunk is exhausted.
+    //*************************************************************************
+    bool next(etl::key_value_field& field)
+    {
+      etl::csv_field csv;
+
+      if (parser.next(csv))
+      {
+        split(csv, field);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Signals the end of the input.
+    /// Returns the last pair if the input did not end with a record delimiter.
+    //*************************************************************************
+    bool flush(etl::key_value_field& field)
+    {
+      etl::csv_field csv;
+
+      if (parser.flush(csv))
+      {
+        split(csv, field);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Discards any unread and partial input.
+    //*************************************************************************
+    void clear()
+    {
+      parser.clear();
+    }
+
+    //*************************************************************************
+    /// The maximum length of a field that straddles chunks.
+    //*************************************************************************
+    size_t max_field_size() const
+    {
+      return parser.max_field_size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ikey_value_parser(etl::icsv_parser& parser_, char separator_)
+      : parser(parser_)
+      , separator(separator_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Splits a field at the first separator.
+    //*************************************************************************
+    void split(const etl::csv_field& csv, etl::key_value_field& field) const
+    {
+      const size_t position = csv.text.find(separator);
+
+      if (position == etl::string_view::npos)
+      {
+        field.key   = csv.text;
+        field.value = csv.text.substr(csv.text.size());
+      }
+      else
+      {
+        field.key   = csv.text.substr(0U, position);
+        field.value = csv.text.substr(position + 1U);
+      }
+
+      field.index            = csv.index;
+      field.is_end_of_record = csv.is_end_of_record;
+    }
+
+    // Disable copy construction and assignment.
+    ikey_value_parser(const ikey_value_parser&) ETL_DELETE;
+    ikey_value_parser& operator=(const ikey_value_parser&) ETL_DELETE;
+
+    etl::icsv_parser& parser;
+    char              separator;
+  };
+
+  //***************************************************************************
+  /// Incremental parser for key=value fields.
+  ///\tparam Max_Field_Size The maximum length of a field that straddles chunks.
+  ///\ingroup csv_parser
+  //***************************************************************************
+  template <size_t Max_Field_Size>
+  class key_value_parser : public etl::ikey_value_parser
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAX_FIELD_SIZE = Max_Field_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Defaults to "key=value" pairs separated by commas or semicolons, with
+    /// line based records.
+    /// Quoted keys and values are not supported. See icsv_parser.
+    //*************************************************************************
+    key_value_parser(char separator_ = '=', const char* field_delimiters_ = ",;", const char* record_delimiters_ = "\r\n")
+      : ikey_value_parser(csv, separator_)
+      , csv(field_delimiters_, record_delimiters_)
+    {
+    }
+
+  private:
+
+    etl::csv_parser<Max_Field_Size> csv;
+  };
+
+  template <size_t Max_Field_Size>
+  ETL_CONSTANT size_t key_value_parser<Max_Field_Size>::MAX_FIELD_SIZE;
+} // namespace etl
+
+#endif
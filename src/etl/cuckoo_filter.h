@@ -0,0 +1,456 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include "platform.h"
+#include "hash.h"
+#include "parameter_type.h"
+#include "power.h"
+#include "smallest.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A cuckoo filter. An approximate membership structure that supports
+/// removal.
+///\ingroup containers
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity cuckoo filter.
+  /// Stores a fingerprint of each key in one of two buckets. The second
+  /// bucket is derived from the first and the fingerprint, so fingerprints
+  /// may be moved between buckets without the original key. When both
+  /// buckets are full, fingerprints are kicked to their alternate buckets, up
+  /// to a bounded number of times.
+  /// The false positive rate is approximately
+  /// (2 * Bucket_Size) / 2^Fingerprint_Bits, so 16 bits and buckets of 4 give
+  /// about 0.012%, at about 17 bits per key. A Bloom filter needs about 19
+  /// bits per key for the same rate.
+  /// Fingerprints are held in the smallest unsigned type that fits, so 8, 16
+  /// and 32 bits make the best use of the space.
+  /// Unlike a Bloom filter, keys may be removed, but only keys that were
+  /// added. Each copy of a key that is added occupies a slot.
+  ///\tparam TKey             The key type.
+  ///\tparam Capacity         The number of keys to be stored.
+  ///\tparam Fingerprint_Bits The number of bits in a fingerprint. 1 to 32.
+  ///\tparam Bucket_Size      The number of fingerprints in a bucket.
+  ///\tparam THash            The hash for the key. Defaults to etl::hash.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits = 16U, size_t Bucket_Size = 4U, typename THash = etl::hash<TKey> >
+  class cuckoo_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Capacity > 0U, "Capacity must be greater than zero");
+    ETL_STATIC_ASSERT((Fingerprint_Bits > 0U) && (Fingerprint_Bits <= 32U), "Fingerprint_Bits must be 1 to 32");
+    ETL_STATIC_ASSERT(Bucket_Size > 0U, "Bucket_Size must be greater than zero");
+
+    typedef TKey                                                          key_type;
+    typedef typename etl::parameter_type<TKey>::type                      parameter_t;
+    typedef typename etl::smallest_uint_for_bits<Fingerprint_Bits>::type fingerprint_type;
+
+    /// The maximum number of times that a fingerprint is kicked to its
+    /// alternate bucket, before the filter is treated as full.
+    static ETL_CONSTANT size_t Max_Kicks = 500U;
+
+  private:
+
+    static ETL_CONSTANT size_t Minimum_Buckets = etl::power_of_2_round_up<(Capacity + Bucket_Size - 1U) / Bucket_Size>::value;
+
+  public:
+
+    /// A power of 2, with a load no higher than 96% at full capacity.
+    static ETL_CONSTANT size_t Number_Of_Buckets =
+      ((Capacity * 100U) > (Minimum_Buckets * Bucket_Size * 96U)) ? (Minimum_Buckets * 2U) : Minimum_Buckets;
+
+    static ETL_CONSTANT size_t Number_Of_Slots = Number_Of_Buckets * Bucket_Size;
+
+    //*************************************************************************
+    /// Constructor. The filter is empty.
+    //*************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Number_Of_Slots; ++i)
+      {
+        slots[i] = Empty;
+      }
+
+      item_count   = 0U;
+      has_victim   = false;
+      victim       = Empty;
+      victim_index = 0U;
+      random       = 0x9E3779B9UL;
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    ///\return <b>false</b> if the filter is full, in which case the key was not
+    /// added.
+    //*************************************************************************
+    bool add(parameter_t key)
+    {
+      if (has_victim)
+      {
+        return false;
+      }
+
+      size_t           index       = 0U;
+      fingerprint_type fingerprint = Empty;
+
+      locate(key, index, fingerprint);
+
+      if (insert_into_bucket(index, fingerprint) || insert_into_bucket(alternate_index(index, fingerprint), fingerprint))
+      {
+        ++item_count;
+        return true;
+      }
+
+      // Both buckets are full. Make room by kicking out fingerprints.
+      if (next_random() & 1U)
+      {
+        index = alternate_index(index, fingerprint);
+      }
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        // Swap with a random slot in the bucket.
+        fingerprint_type& slot = slots[(index * Bucket_Size) + (next_random() % Bucket_Size)];
+
+        const fingerprint_type evicted = slot;
+        slot                           = fingerprint;
+        fingerprint                    = evicted;
+
+        index = alternate_index(index, fingerprint);
+
+        if (insert_into_bucket(index, fingerprint))
+        {
+          ++item_count;
+          return true;
+        }
+      }
+
+      // Keep the last fingerprint aside, so that no key is lost. The filter
+      // is now full.
+      has_victim   = true;
+      victim       = fingerprint;
+      victim_index = index;
+      ++item_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it may exist in the filter.
+    ///\param key The key to test.
+    ///\return <b>true</b> if the key may exist in the filter.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      size_t           index       = 0U;
+      fingerprint_type fingerprint = Empty;
+
+      locate(key, index, fingerprint);
+
+      const size_t index2 = alternate_index(index, fingerprint);
+
+      if (has_victim && (victim == fingerprint) && ((victim_index == index) || (victim_index == index2)))
+      {
+        return true;
+      }
+
+      return bucket_contains(index, fingerprint) || bucket_contains(index2, fingerprint);
+    }
+
+    //*************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that were added may be removed. Removing a key that was not
+    /// added, but which is a false positive, removes another key.
+    ///\param key The key to remove.
+    ///\return <b>true</b> if a fingerprint for the key was removed.
+    //*************************************************************************
+    bool remove(parameter_t key)
+    {
+      size_t           index       = 0U;
+      fingerprint_type fingerprint = Empty;
+
+      locate(key, index, fingerprint);
+
+      const size_t index2 = alternate_index(index, fingerprint);
+
+      if (remove_from_bucket(index, fingerprint) || remove_from_bucket(index2, fingerprint))
+      {
+        --item_count;
+
+        // There is now room for the fingerprint that was put aside.
+        if (has_victim)
+        {
+          has_victim = false;
+          --item_count;
+
+          reinsert_victim();
+        }
+
+        return true;
+      }
+
+      if (has_victim && (victim == fingerprint) && ((victim_index == index) || (victim_index == index2)))
+      {
+        has_victim = false;
+        --item_count;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys in the filter.
+    //*************************************************************************
+    size_t size() const
+    {
+      return item_count;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity requested for the filter.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity()
+    {
+      return Capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprint slots in the filter.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t number_of_slots()
+    {
+      return Number_Of_Slots;
+    }
+
+    //*************************************************************************
+    /// Checks if the filter is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return item_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the filter is full. Adds will fail until a key is removed.
+    //*************************************************************************
+    bool full() const
+    {
+      return has_victim;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of slots used. Range 0 to 100.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return (100U * item_count) / Number_Of_Slots;
+    }
+
+  private:
+
+    static ETL_CONSTANT fingerprint_type Empty = 0U;
+
+    static ETL_CONSTANT uint64_t Fingerprint_Mask = (uint64_t(1U) << Fingerprint_Bits) - 1U;
+
+    //*************************************************************************
+    /// Calculates the first bucket and the fingerprint for the key.
+    /// The fingerprint is never zero, as that marks an empty slot.
+    //*************************************************************************
+    static void locate(parameter_t key, size_t& index, fingerprint_type& fingerprint)
+    {
+      // Finalised, as etl::hash may be the identity.
+      const uint64_t hash = etl::private_hash::murmur3_finalise_64(static_cast<uint64_t>(THash()(key)));
+
+      index       = static_cast<size_t>(hash) & (Number_Of_Buckets - 1U);
+      fingerprint = static_cast<fingerprint_type>((hash >> 32U) & Fingerprint_Mask);
+
+      if (fingerprint == Empty)
+      {
+        fingerprint = 1U;
+      }
+    }
+
+    //*************************************************************************
+    /// The other bucket for the fingerprint. Applying it twice returns the
+    /// original bucket.
+    //*************************************************************************
+    static size_t alternate_index(size_t index, fingerprint_type fingerprint)
+    {
+      return (index ^ static_cast<size_t>(static_cast<uint32_t>(fingerprint) * 0x5BD1E995UL)) & (Number_Of_Buckets - 1U);
+    }
+
+    //*************************************************************************
+    bool bucket_contains(size_t index, fingerprint_type fingerprint) const
+    {
+      const fingerprint_type* bucket = slots + (index * Bucket_Size);
+
+      bool found = false;
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        found |= (bucket[i] == fingerprint);
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    bool insert_into_bucket(size_t index, fingerprint_type fingerprint)
+    {
+      fingerprint_type* bucket = slots + (index * Bucket_Size);
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        if (bucket[i] == Empty)
+        {
+          bucket[i] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    bool remove_from_bucket(size_t index, fingerprint_type fingerprint)
+    {
+      fingerprint_type* bucket = slots + (index * Bucket_Size);
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        if (bucket[i] == fingerprint)
+        {
+          bucket[i] = Empty;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Tries to place the fingerprint that was put aside when the filter
+    /// became full.
+    //*************************************************************************
+    void reinsert_victim()
+    {
+      size_t           index       = victim_index;
+      fingerprint_type fingerprint = victim;
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        if (insert_into_bucket(index, fingerprint) || insert_into_bucket(alternate_index(index, fingerprint), fingerprint))
+        {
+          ++item_count;
+          return;
+        }
+
+        fingerprint_type& slot = slots[(index * Bucket_Size) + (next_random() % Bucket_Size)];
+
+        const fingerprint_type evicted = slot;
+        slot                           = fingerprint;
+        fingerprint                    = evicted;
+
+        index = alternate_index(index, fingerprint);
+      }
+
+      has_victim   = true;
+      victim       = fingerprint;
+      victim_index = index;
+      ++item_count;
+    }
+
+    //*************************************************************************
+    /// A xorshift generator, for choosing the slots to kick.
+    //*************************************************************************
+    uint32_t next_random()
+    {
+      random ^= random << 13U;
+      random ^= random >> 17U;
+      random ^= random << 5U;
+
+      return random;
+    }
+
+    fingerprint_type slots[Number_Of_Slots];
+    size_t           item_count;
+    bool             has_victim;
+    fingerprint_type victim;       ///< The fingerprint that could not be placed when the filter became full.
+    size_t           victim_index; ///< The bucket that it belongs to.
+    uint32_t         random;
+  };
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Max_Kicks;
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Minimum_Buckets;
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Number_Of_Buckets;
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Number_Of_Slots;
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT typename cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::fingerprint_type
+    cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Empty;
+
+  template <typename TKey, size_t Capacity, size_t Fingerprint_Bits, size_t Bucket_Size, typename THash>
+  ETL_CONSTANT uint64_t cuckoo_filter<TKey, Capacity, Fingerprint_Bits, Bucket_Size, THash>::Fingerprint_Mask;
+} // namespace etl
+
+#endif
+
+#endif
@@ -0,0 +1,397 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_SCHEDULER_INCLUDED
+#define ETL_EVENT_SCHEDULER_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "atomic.h"
+#include "binary.h"
+#include "error_handler.h"
+#include "function.h"
+#include "nullptr.h"
+#include "scheduler.h"
+#include "task.h"
+#include "vector.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <size_t MAX_TASKS_>
+  class event_scheduler;
+
+  //***************************************************************************
+  /// A task that is told when it has work, rather than being asked.
+  /// notify() may be called from interrupts or other threads. Each call to
+  /// task_process_work() takes one unit of the notified work and calls
+  /// task_process_event().
+  /// An event_task may also be used with etl::scheduler, as
+  /// task_request_work() returns the number of units of work outstanding.
+  //***************************************************************************
+  class event_task : public etl::task
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    event_task(task_priority_t priority)
+      : etl::task(priority)
+      , pending(0U)
+      , p_ready_word(ETL_NULLPTR)
+      , ready_mask(0U)
+    {
+    }
+
+    //*******************************************
+    /// Adds units of work for the task, and marks it as ready.
+    //*******************************************
+    void notify(uint32_t n = 1U)
+    {
+      pending.fetch_add(n);
+
+      // Only write to the shared ready set if the flag is not already set.
+      if ((p_ready_word != ETL_NULLPTR) && ((p_ready_word->load() & ready_mask) == 0U))
+      {
+        p_ready_word->fetch_or(ready_mask);
+      }
+    }
+
+    //*******************************************
+    /// Returns the number of units of work outstanding.
+    //*******************************************
+    uint32_t pending_work() const
+    {
+      return pending.load();
+    }
+
+    //*******************************************
+    /// Returns the number of units of work outstanding.
+    //*******************************************
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return pending_work();
+    }
+
+    //*******************************************
+    /// Takes one unit of work and processes it.
+    //*******************************************
+    void task_process_work() ETL_OVERRIDE
+    {
+      if (take_work())
+      {
+        task_process_event();
+      }
+    }
+
+    //*******************************************
+    /// Called to process one unit of work.
+    //*******************************************
+    virtual void task_process_event() = 0;
+
+  private:
+
+    template <size_t>
+    friend class event_scheduler;
+
+    //*******************************************
+    /// Takes one unit of work, if there is any.
+    /// Clears the ready flag when the last is taken.
+    /// Work is only taken by the scheduler, so the count cannot fall between
+    /// the check and the decrement.
+    //*******************************************
+    bool take_work()
+    {
+      if (pending.load() == 0U)
+      {
+        clear_ready();
+        return false;
+      }
+
+      if (pending.fetch_sub(1U) == 1U)
+      {
+        clear_ready();
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Clears the ready flag.
+    /// The flag is set again if work was notified meanwhile.
+    //*******************************************
+    void clear_ready()
+    {
+      if (p_ready_word != ETL_NULLPTR)
+      {
+        p_ready_word->fetch_and(~ready_mask);
+
+        if (pending.load() != 0U)
+        {
+          p_ready_word->fetch_or(ready_mask);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Sets the ready flag that the task signals through.
+    //*******************************************
+    void bind(etl::atomic<uint32_t>* p_ready_word_, uint32_t ready_mask_)
+    {
+      p_ready_word = p_ready_word_;
+      ready_mask   = ready_mask_;
+
+      if (pending.load() != 0U)
+      {
+        p_ready_word->fetch_or(ready_mask);
+      }
+    }
+
+    etl::atomic<uint32_t>  pending;      ///< The units of work outstanding.
+    etl::atomic<uint32_t>* p_ready_word; ///< The word of the scheduler's ready set that holds the flag.
+    uint32_t               ready_mask;   ///< The flag in the ready set.
+  };
+
+  //***************************************************************************
+  /// A scheduler for event_tasks that runs the highest priority ready task.
+  /// Tasks signal that they are ready, so there is no polling. Each task has a
+  /// flag in a ready set, ordered by priority, and the next task is found with
+  /// a count of trailing zeros per 32 tasks.
+  /// When no task is ready the idle callback is called, which may sleep until
+  /// the next interrupt.
+  /// All tasks must be added before the scheduler is started.
+  //***************************************************************************
+  template <size_t MAX_TASKS_>
+  class event_scheduler
+  {
+  public:
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    event_scheduler()
+      : scheduler_running(false)
+      , scheduler_exit(false)
+      , p_idle_callback(ETL_NULLPTR)
+      , p_watchdog_callback(ETL_NULLPTR)
+    {
+      for (size_t i = 0U; i < Ready_Words; ++i)
+      {
+        ready[i].store(0U);
+      }
+    }
+
+    //*******************************************
+    /// Set the idle callback.
+    //*******************************************
+    void set_idle_callback(etl::ifunction<void>& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback.
+    //*******************************************
+    void set_watchdog_callback(etl::ifunction<void>& callback)
+    {
+      p_watchdog_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the running state for the scheduler.
+    //*******************************************
+    void set_scheduler_running(bool scheduler_running_)
+    {
+      scheduler_running = scheduler_running_;
+    }
+
+    //*******************************************
+    /// Get the running state for the scheduler.
+    //*******************************************
+    bool scheduler_is_running() const
+    {
+      return scheduler_running;
+    }
+
+    //*******************************************
+    /// Force the scheduler to exit.
+    //*******************************************
+    void exit_scheduler()
+    {
+      scheduler_exit = true;
+    }
+
+    //*******************************************
+    /// Add a task.
+    /// Add to the task list in priority order.
+    //*******************************************
+    void add_task(etl::event_task& task)
+    {
+      ETL_ASSERT(!task_list.full(), ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+
+      if (!task_list.full())
+      {
+        typename task_list_t::iterator itask = etl::upper_bound(task_list.begin(), task_list.end(), task.get_task_priority(), compare_priority());
+
+        task_list.insert(itask, &task);
+
+        bind_tasks();
+
+        task.on_task_added();
+      }
+    }
+
+    //*******************************************
+    /// Add a task list.
+    /// Adds to the tasks to the internal task list in priority order.
+    /// Input order is ignored.
+    //*******************************************
+    template <typename TSize>
+    void add_task_list(etl::event_task** p_tasks, TSize size)
+    {
+      for (TSize i = 0; i < size; ++i)
+      {
+        ETL_ASSERT((p_tasks[i] != ETL_NULLPTR), ETL_ERROR(etl::scheduler_null_task_exception));
+        add_task(*(p_tasks[i]));
+      }
+    }
+
+    //*******************************************
+    /// Runs the highest priority ready task once.
+    ///\return <b>true</b> if no task was ready.
+    //*******************************************
+    bool schedule_tasks()
+    {
+      for (size_t i = 0U; i < Ready_Words; ++i)
+      {
+        const uint32_t bits = ready[i].load();
+
+        if (bits != 0U)
+        {
+          const size_t index = (i * Bits_Per_Word) + etl::count_trailing_zeros(bits);
+
+          task_list[index]->task_process_work();
+
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    //*******************************************
+    void start()
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      scheduler_running = true;
+
+      while (!scheduler_exit)
+      {
+        if (scheduler_running)
+        {
+          bool idle = schedule_tasks();
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bits_Per_Word = 32U;
+    static ETL_CONSTANT size_t Ready_Words   = (MAX_TASKS_ + Bits_Per_Word - 1U) / Bits_Per_Word;
+
+    //*******************************************
+    // Used to order tasks in descending priority.
+    //*******************************************
+    struct compare_priority
+    {
+      bool operator()(etl::task_priority_t priority, etl::event_task* ptask) const
+      {
+        return priority > ptask->get_task_priority();
+      }
+    };
+
+    //*******************************************
+    /// Gives each task the flag for its position in the task list.
+    //*******************************************
+    void bind_tasks()
+    {
+      for (size_t i = 0U; i < Ready_Words; ++i)
+      {
+        ready[i].store(0U);
+      }
+
+      for (size_t index = 0U; index < task_list.size(); ++index)
+      {
+        task_list[index]->bind(&ready[index / Bits_Per_Word], uint32_t(1U) << (index % Bits_Per_Word));
+      }
+    }
+
+    typedef etl::vector<etl::event_task*, MAX_TASKS_> task_list_t;
+
+    bool                  scheduler_running;
+    bool                  scheduler_exit;
+    etl::ifunction<void>* p_idle_callback;
+    etl::ifunction<void>* p_watchdog_callback;
+    etl::atomic<uint32_t> ready[Ready_Words]; ///< A flag for each task, highest priority first.
+    task_list_t           task_list;
+  };
+
+  template <size_t MAX_TASKS_>
+  ETL_CONSTANT size_t event_scheduler<MAX_TASKS_>::Bits_Per_Word;
+
+  template <size_t MAX_TASKS_>
+  ETL_CONSTANT size_t event_scheduler<MAX_TASKS_>::Ready_Words;
+} // namespace etl
+
+#endif
+
+#endif
@@ -112,4 +112,10 @@ SOFTWARE.
 #define ETL_FORMAT_FILE_ID                         "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID               "80"
 #define ETL_INTRUSIVE_AVL_TREE_FILE_ID             "81"
+#define ETL_CSV_PARSER_FILE_ID                     "82"
+#define ETL_SOA_FLAT_FILE_ID                       "83"
+#define ETL_HIERARCHICAL_BITSET_FILE_ID            "84"
+#define ETL_INDEX_ALLOCATOR_FILE_ID                "85"
+#define ETL_COROUTINE_FILE_ID                      "86"
+#define ETL_STATE_CHART_FILE_ID                    "87"
 #endif
@@ -324,6 +324,43 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key, with a
+    /// single O(N + M) merge, rather than a search and a shift per element.
+    /// Keys already in the flat_set are left unchanged.
+    /// The range must be bidirectional.
+    /// If asserts or exceptions are enabled, emits flat_set_iterator if the
+    /// range is not sorted, or flat_set_full if the new values will not fit.
+    /// In either case the flat_set is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      const size_t n_new = refset_t::merge_sorted(first, last, allocate_value(storage));
+
+      ETL_ADD_DEBUG_COUNT(n_new);
+      static_cast<void>(n_new);
+    }
+
+    //*********************************************************************
+    /// Assigns a range of values, sorted by strictly increasing key, with a
+    /// single pass.
+    /// The range must be bidirectional.
+    /// If asserts or exceptions are enabled, emits flat_set_iterator if the
+    /// range is not sorted, or flat_set_full if the flat_set does not have
+    /// enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert(etl::sorted_unique_t(), first, last);
+    }
+
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -971,6 +1008,31 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Copies an element of a range into the storage, for merge_sorted.
+    //*********************************************************************
+    class allocate_value
+    {
+    public:
+
+      explicit allocate_value(storage_t& storage_)
+        : storage(storage_)
+      {
+      }
+
+      template <typename TIterator>
+      value_type& operator()(TIterator itr) const
+      {
+        value_type* pvalue = storage.template allocate<value_type>();
+        ::new (pvalue) value_type(*itr);
+        return *pvalue;
+      }
+
+    private:
+
+      storage_t& storage;
+    };
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
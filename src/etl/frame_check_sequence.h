@@ -146,11 +146,17 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
+      // Accumulate in a local, as stores to the member could alias the input
+      // data and force a store and reload for every byte.
+      value_type fcs = frame_check;
+
       while (begin != end)
       {
-        frame_check = policy.add(frame_check, static_cast<uint8_t>(*begin));
+        fcs = policy.add(fcs, static_cast<uint8_t>(*begin));
         ++begin;
       }
+
+      frame_check = fcs;
     }
 
     //*************************************************************************
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "largest.h"
 #include "message_router.h"
 #include "nullptr.h"
+#include "static_assert.h"
 #include "user_type.h"
 #if ETL_USING_CPP11
   #include "tuple.h"
@@ -51,6 +52,7 @@ namespace etl
 {
   class fsm;
   class hfsm;
+  class ifsm_dispatch_table;
 
   /// Allow alternative type for state id.
 #if !defined(ETL_FSM_STATE_ID_TYPE)
@@ -147,6 +149,19 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Exception for a state list that does not fit the dispatch table.
+  //***************************************************************************
+  class fsm_dispatch_table_exception : public etl::fsm_exception
+  {
+  public:
+
+    fsm_dispatch_table_exception(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:dispatch table", ETL_FSM_FILE_ID"E"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Exception for call to receive/start/etc. while receive/start/etc. is
   /// already happening. A call like that could result in an infinite loop or
@@ -319,6 +334,7 @@ namespace etl
     /// Allows ifsm_state functions to be private.
     friend class etl::fsm;
     friend class etl::hfsm;
+    friend class etl::ifsm_dispatch_table;
 
     using private_fsm::ifsm_state_helper<>::No_State_Change;
     using private_fsm::ifsm_state_helper<>::Pass_To_Parent;
@@ -398,8 +414,36 @@ namespace etl
 
   private:
 
+    /// A handler for one message type of a state.
+    typedef etl::fsm_state_id_t (*event_handler_t)(etl::ifsm_state&, const etl::imessage&);
+
     virtual fsm_state_id_t process_event(const etl::imessage& message) = 0;
 
+    //*******************************************
+    /// Gets this state's own handler for a message id, or ETL_NULLPTR if it
+    /// does not handle it.
+    /// By default, every message is handled by process_event(), which passes
+    /// it up the hierarchy itself.
+    //*******************************************
+    virtual event_handler_t get_event_handler(etl::message_id_t) const
+    {
+      return &ifsm_state::process_event_handler;
+    }
+
+    //*******************************************
+    /// Called when no state in the hierarchy handles a message.
+    //*******************************************
+    virtual fsm_state_id_t process_unknown_event(const etl::imessage& message)
+    {
+      return process_event(message);
+    }
+
+    //*******************************************
+    static fsm_state_id_t process_event_handler(etl::ifsm_state& state, const etl::imessage& message)
+    {
+      return state.process_event(message);
+    }
+
     virtual fsm_state_id_t on_enter_state()
     {
       return No_State_Change;
@@ -432,6 +476,358 @@ namespace etl
     ifsm_state& operator=(const ifsm_state&) ETL_DELETE;
   };
 
+  //***************************************************************************
+  /// A precomputed [state][message id] table of event handlers for an FSM.
+  /// Each entry holds the handler of the first state, starting from the state
+  /// itself and walking up the hierarchy, that handles the message. A message
+  /// is then dispatched with a single table access, rather than through each
+  /// state's own dispatch and its parents. Handlers that return Pass_To_Parent
+  /// continue from the entry of the handling state's parent.
+  /// Messages with ids outside the table are dispatched as normal.
+  /// The storage is supplied by etl::fsm_dispatch_table.
+  //***************************************************************************
+  class ifsm_dispatch_table
+  {
+  public:
+
+    typedef etl::ifsm_state::event_handler_t event_handler_t;
+
+    //*******************************************
+    /// Checks if the table was built from the states.
+    //*******************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //*******************************************
+    /// Checks if the table has entries for the state and message id.
+    //*******************************************
+    bool contains(etl::fsm_state_id_t state_id, etl::message_id_t message_id) const
+    {
+      return valid && (state_id < number_of_states) && (message_id < max_message_ids);
+    }
+
+    //*******************************************
+    /// Builds the table from the FSM's state list.
+    /// Must be rebuilt if the state hierarchy is changed.
+    ///\return <b>true</b> if the states fit the table.
+    //*******************************************
+    bool build(etl::ifsm_state** state_list, etl::fsm_state_id_t number_of_states_)
+    {
+      valid            = false;
+      number_of_states = 0U;
+
+      if ((state_list == ETL_NULLPTR) || (number_of_states_ > max_states))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::fsm_dispatch_table_exception));
+        return false;
+      }
+
+      for (size_t state_id = 0U; state_id < number_of_states_; ++state_id)
+      {
+        for (size_t message_id = 0U; message_id < max_message_ids; ++message_id)
+        {
+          entry& e = p_entries[(state_id * max_message_ids) + message_id];
+
+          e.handler  = ETL_NULLPTR;
+          e.state_id = etl::ifsm_state::No_State_Change;
+
+          // Find the first state in the hierarchy with a handler.
+          for (etl::ifsm_state* p_state = state_list[state_id]; p_state != ETL_NULLPTR; p_state = p_state->p_parent)
+          {
+            event_handler_t handler = p_state->get_event_handler(etl::message_id_t(message_id));
+
+            if (handler != ETL_NULLPTR)
+            {
+              e.handler  = handler;
+              e.state_id = p_state->get_state_id();
+              break;
+            }
+          }
+        }
+      }
+
+      number_of_states = number_of_states_;
+      valid            = true;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Dispatches a message to the handlers for the state.
+    /// The state and message id must be contained in the table.
+    //*******************************************
+    etl::fsm_state_id_t dispatch(etl::ifsm_state** state_list, etl::ifsm_state& state, const etl::imessage& message) const
+    {
+      const etl::message_id_t message_id = message.get_message_id();
+
+      const entry*     p_entry   = &p_entries[(size_t(state.get_state_id()) * max_message_ids) + message_id];
+      etl::ifsm_state* p_handler = &state;
+
+      while (p_entry->handler != ETL_NULLPTR)
+      {
+        p_handler = state_list[p_entry->state_id];
+
+        const etl::fsm_state_id_t next_state_id = p_entry->handler(*p_handler, message);
+
+        if (next_state_id != etl::ifsm_state::Pass_To_Parent)
+        {
+          return next_state_id;
+        }
+
+        if (p_handler->p_parent == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        p_entry = &p_entries[(size_t(p_handler->p_parent->get_state_id()) * max_message_ids) + message_id];
+      }
+
+      // Not handled, so pass it to the top of the hierarchy.
+      while (p_handler->p_parent != ETL_NULLPTR)
+      {
+        p_handler = p_handler->p_parent;
+      }
+
+      return p_handler->process_unknown_event(message);
+    }
+
+  protected:
+
+    //*******************************************
+    /// An entry in the table.
+    //*******************************************
+    struct entry
+    {
+      event_handler_t     handler;  ///< The handler, or ETL_NULLPTR if no state handles the message.
+      etl::fsm_state_id_t state_id; ///< The state that the handler belongs to.
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    ifsm_dispatch_table(entry* p_entries_, size_t max_states_, size_t max_message_ids_)
+      : p_entries(p_entries_)
+      , max_states(max_states_)
+      , max_message_ids(max_message_ids_)
+      , number_of_states(0U)
+      , valid(false)
+    {
+    }
+
+  private:
+
+    // Disabled.
+    ifsm_dispatch_table(const ifsm_dispatch_table&) ETL_DELETE;
+    ifsm_dispatch_table& operator=(const ifsm_dispatch_table&) ETL_DELETE;
+
+    entry*       p_entries;
+    const size_t max_states;
+    const size_t max_message_ids;
+    size_t       number_of_states;
+    bool         valid;
+  };
+
+  //***************************************************************************
+  /// The storage for an FSM dispatch table.
+  ///\tparam Max_States      The maximum number of states.
+  ///\tparam Max_Message_Ids Message ids less than this are dispatched through
+  /// the table.
+  //***************************************************************************
+  template <size_t Max_States, size_t Max_Message_Ids>
+  class fsm_dispatch_table : public ifsm_dispatch_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_States > 0U, "Max_States must be greater than zero");
+    ETL_STATIC_ASSERT(Max_Message_Ids > 0U, "Max_Message_Ids must be greater than zero");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    fsm_dispatch_table()
+      : ifsm_dispatch_table(entries, Max_States, Max_Message_Ids)
+    {
+    }
+
+  private:
+
+    entry entries[Max_States * Max_Message_Ids];
+  };
+
+  //***************************************************************************
+  /// The interface for an FSM trace hook.
+  /// Called at the start and end of the handling of each message, and when
+  /// the current state changes. A state id of ifsm_state::No_State_Change
+  /// means that the FSM was not started, or has been reset.
+  //***************************************************************************
+  class ifsm_trace
+  {
+  public:
+
+    virtual ~ifsm_trace() {}
+
+    virtual void on_event_begin(etl::fsm_state_id_t state_id, etl::message_id_t message_id) = 0;
+    virtual void on_event_end(etl::fsm_state_id_t state_id, etl::message_id_t message_id)   = 0;
+    virtual void on_state_change(etl::fsm_state_id_t previous_state_id, etl::fsm_state_id_t state_id) = 0;
+  };
+
+  //***************************************************************************
+  /// An FSM trace hook that records the time spent in each state, and the
+  /// time taken to handle each message id, including any state change.
+  /// Times are read from a free running counter, such as a cycle counter.
+  ///\tparam Max_States      Records are kept for state ids less than this.
+  ///\tparam Max_Message_Ids Records are kept for message ids less than this.
+  //***************************************************************************
+  template <size_t Max_States, size_t Max_Message_Ids>
+  class fsm_profiler : public ifsm_trace
+  {
+  public:
+
+    typedef uint32_t (*counter_t)();
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t total_t;
+#else
+    typedef uint32_t total_t;
+#endif
+
+    //*******************************************
+    /// Constructor.
+    ///\param get_counter_ Returns the current value of the counter.
+    //*******************************************
+    explicit fsm_profiler(counter_t get_counter_)
+      : get_counter(get_counter_)
+    {
+      clear();
+    }
+
+    //*******************************************
+    void on_event_begin(etl::fsm_state_id_t, etl::message_id_t) ETL_OVERRIDE
+    {
+      event_start = get_counter();
+    }
+
+    //*******************************************
+    void on_event_end(etl::fsm_state_id_t, etl::message_id_t message_id) ETL_OVERRIDE
+    {
+      const uint32_t cycles = uint32_t(get_counter() - event_start);
+
+      if (message_id < Max_Message_Ids)
+      {
+        event_record& record = events[message_id];
+
+        ++record.count;
+        record.total_cycles += cycles;
+
+        if (cycles > record.max_cycles)
+        {
+          record.max_cycles = cycles;
+        }
+      }
+    }
+
+    //*******************************************
+    void on_state_change(etl::fsm_state_id_t previous_state_id, etl::fsm_state_id_t) ETL_OVERRIDE
+    {
+      const uint32_t now = get_counter();
+
+      if (previous_state_id < Max_States)
+      {
+        state_record& record = states[previous_state_id];
+
+        ++record.count;
+        record.total_cycles += uint32_t(now - state_start);
+      }
+
+      state_start = now;
+    }
+
+    //*******************************************
+    /// Gets the number of completed visits to the state.
+    //*******************************************
+    uint32_t get_state_visits(etl::fsm_state_id_t state_id) const
+    {
+      return (state_id < Max_States) ? states[state_id].count : 0U;
+    }
+
+    //*******************************************
+    /// Gets the total time spent in the state, for completed visits.
+    //*******************************************
+    total_t get_state_dwell(etl::fsm_state_id_t state_id) const
+    {
+      return (state_id < Max_States) ? states[state_id].total_cycles : 0U;
+    }
+
+    //*******************************************
+    /// Gets the number of messages handled with the id.
+    //*******************************************
+    uint32_t get_event_count(etl::message_id_t message_id) const
+    {
+      return (message_id < Max_Message_Ids) ? events[message_id].count : 0U;
+    }
+
+    //*******************************************
+    /// Gets the total time taken to handle messages with the id.
+    //*******************************************
+    total_t get_event_cycles(etl::message_id_t message_id) const
+    {
+      return (message_id < Max_Message_Ids) ? events[message_id].total_cycles : 0U;
+    }
+
+    //*******************************************
+    /// Gets the longest time taken to handle a message with the id.
+    //*******************************************
+    uint32_t get_event_max_cycles(etl::message_id_t message_id) const
+    {
+      return (message_id < Max_Message_Ids) ? events[message_id].max_cycles : 0U;
+    }
+
+    //*******************************************
+    /// Clears the records.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Max_States; ++i)
+      {
+        states[i].count        = 0U;
+        states[i].total_cycles = 0U;
+      }
+
+      for (size_t i = 0U; i < Max_Message_Ids; ++i)
+      {
+        events[i].count        = 0U;
+        events[i].total_cycles = 0U;
+        events[i].max_cycles   = 0U;
+      }
+
+      state_start = get_counter();
+      event_start = state_start;
+    }
+
+  private:
+
+    struct state_record
+    {
+      uint32_t count;
+      total_t  total_cycles;
+    };
+
+    struct event_record
+    {
+      uint32_t count;
+      total_t  total_cycles;
+      uint32_t max_cycles;
+    };
+
+    counter_t    get_counter;
+    uint32_t     state_start; ///< The time that the current state was entered.
+    uint32_t     event_start; ///< The time that the current message was received.
+    state_record states[Max_States];
+    event_record events[Max_Message_Ids];
+  };
+
   //***************************************************************************
   /// The FSM class.
   //***************************************************************************
@@ -451,6 +847,8 @@ namespace etl
       , state_list(ETL_NULLPTR)
       , number_of_states(0U)
       , is_processing_state_change(false)
+      , p_dispatch_table(ETL_NULLPTR)
+      , p_trace(ETL_NULLPTR)
     {
     }
 
@@ -493,6 +891,41 @@ namespace etl
     }
 #endif
 
+    //*******************************************
+    /// Sets the table that messages are dispatched through, and builds it
+    /// from the states.
+    /// Must be called after the states, and any child states, have been set.
+    //*******************************************
+    void set_dispatch_table(etl::ifsm_dispatch_table& dispatch_table)
+    {
+      p_dispatch_table = &dispatch_table;
+      p_dispatch_table->build(state_list, number_of_states);
+    }
+
+    //*******************************************
+    /// Stops dispatching messages through a table.
+    //*******************************************
+    void clear_dispatch_table()
+    {
+      p_dispatch_table = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Sets the hook that is told of each message and state change.
+    //*******************************************
+    void set_trace(etl::ifsm_trace& trace)
+    {
+      p_trace = &trace;
+    }
+
+    //*******************************************
+    /// Removes the trace hook.
+    //*******************************************
+    void clear_trace()
+    {
+      p_trace = ETL_NULLPTR;
+    }
+
     //*******************************************
     /// Starts the FSM.
     /// Can only be called once.
@@ -525,6 +958,8 @@ namespace etl
             }
           } while (p_last_state != p_state);
         }
+
+        trace_state_change(ifsm_state::No_State_Change);
       }
     }
 
@@ -537,9 +972,20 @@ namespace etl
 
       if (is_started())
       {
-        etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+        if (p_trace == ETL_NULLPTR)
+        {
+          process_state_change(dispatch_event(message));
+        }
+        else
+        {
+          const etl::fsm_state_id_t previous_state_id = p_state->get_state_id();
+          const etl::message_id_t   message_id        = message.get_message_id();
 
-        process_state_change(next_state_id);
+          p_trace->on_event_begin(previous_state_id, message_id);
+          process_state_change(dispatch_event(message));
+          trace_state_change(previous_state_id);
+          p_trace->on_event_end(previous_state_id, message_id);
+        }
       }
       else
       {
@@ -556,7 +1002,12 @@ namespace etl
 
       if (is_started())
       {
-        return process_state_change(new_state_id);
+        const etl::fsm_state_id_t previous_state_id = p_state->get_state_id();
+
+        process_state_change(new_state_id);
+        trace_state_change(previous_state_id);
+
+        return p_state->get_state_id();
       }
       else
       {
@@ -624,7 +1075,11 @@ namespace etl
         p_state->on_exit_state();
       }
 
+      const etl::fsm_state_id_t previous_state_id = is_started() ? p_state->get_state_id() : ifsm_state::No_State_Change;
+
       p_state = ETL_NULLPTR;
+
+      trace_state_change(previous_state_id);
     }
 
     //********************************************
@@ -648,6 +1103,36 @@ namespace etl
 
   private:
 
+    //********************************************
+    /// Passes a message to the current state, through the dispatch table if
+    /// there is one.
+    //********************************************
+    etl::fsm_state_id_t dispatch_event(const etl::imessage& message)
+    {
+      if ((p_dispatch_table != ETL_NULLPTR) && p_dispatch_table->contains(p_state->get_state_id(), message.get_message_id()))
+      {
+        return p_dispatch_table->dispatch(state_list, *p_state, message);
+      }
+
+      return p_state->process_event(message);
+    }
+
+    //********************************************
+    /// Tells the trace hook if the state has changed.
+    //********************************************
+    void trace_state_change(etl::fsm_state_id_t previous_state_id)
+    {
+      if (p_trace != ETL_NULLPTR)
+      {
+        const etl::fsm_state_id_t state_id = is_started() ? p_state->get_state_id() : ifsm_state::No_State_Change;
+
+        if (state_id != previous_state_id)
+        {
+          p_trace->on_state_change(previous_state_id, state_id);
+        }
+      }
+    }
+
     //********************************************
     bool have_changed_state(etl::fsm_state_id_t next_state_id) const
     {
@@ -694,12 +1179,14 @@ namespace etl
       return p_state->get_state_id();
     }
 
-    etl::ifsm_state*    p_state;                    ///< A pointer to the current state.
-    etl::ifsm_state**   state_list;                 ///< The list of added states.
-    etl::fsm_state_id_t number_of_states;           ///< The number of states.
-    bool                is_processing_state_change; ///< Whether a method call that could
-                                                    ///< potentially trigger a state change is
-                                                    ///< active
+    etl::ifsm_state*          p_state;                    ///< A pointer to the current state.
+    etl::ifsm_state**         state_list;                 ///< The list of added states.
+    etl::fsm_state_id_t       number_of_states;           ///< The number of states.
+    bool                      is_processing_state_change; ///< Whether a method call that could
+                                                          ///< potentially trigger a state change is
+                                                          ///< active
+    etl::ifsm_dispatch_table* p_dispatch_table;           ///< The table that messages are dispatched through, if any.
+    etl::ifsm_trace*          p_trace;                    ///< The trace hook, if any.
   };
 
   //*************************************************************************************************
@@ -772,10 +1259,9 @@ namespace etl
     // each message id is one greater than the previous message id.
     static constexpr bool Message_Ids_Are_Contiguous = (Number_Of_Messages <= 1U) ? true : contiguous_impl<0U>::value;
 
-    using handler_ptr = etl::fsm_state_id_t (*)(TDerived&,
-                                                const etl::imessage&); ///< Pointer to a handler function that takes a
-                                                                       ///< reference to the derived class and a
-                                                                       ///< reference to the message.
+    using handler_ptr = ifsm_state::event_handler_t; ///< Pointer to a handler function that takes a
+                                                     ///< reference to the state and a reference to
+                                                     ///< the message.
     using message_dispatch_table_t = etl::array<handler_ptr,
                                                 Number_Of_Messages>; ///< The dispatch table type. An array of
                                                                      ///< handler pointers, one for each
@@ -816,13 +1302,37 @@ namespace etl
   #include "etl/private/diagnostic_pop.h"
     }
 
+    //********************************************
+    // Gets the handler for a message id, for the FSM's dispatch table.
+    //********************************************
+    handler_ptr get_event_handler(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      if (id >= Message_Id_Start)
+      {
+        const size_t index = get_dispatch_index_from_message_id(id);
+
+        if (index < Number_Of_Messages)
+        {
+          return message_dispatch_table[index];
+        }
+      }
+
+      return nullptr;
+    }
+
+    //********************************************
+    etl::fsm_state_id_t process_unknown_event(const etl::imessage& message) ETL_OVERRIDE
+    {
+      return static_cast<TDerived*>(this)->on_event_unknown(message);
+    }
+
     //**********************************************
     // Call for a single message type
     //**********************************************
     template <typename TMessage>
-    static etl::fsm_state_id_t call_on_event(TDerived& derived, const imessage& msg)
+    static etl::fsm_state_id_t call_on_event(ifsm_state& state, const imessage& msg)
     {
-      return derived.on_event(static_cast<const TMessage&>(msg));
+      return static_cast<TDerived&>(state).on_event(static_cast<const TMessage&>(msg));
     }
 
     //**********************************************
@@ -915,7 +1425,7 @@ namespace etl
     //**********************************************
     etl::fsm_state_id_t dispatch(const etl::imessage& msg, size_t index)
     {
-      return message_dispatch_table[index](static_cast<TDerived&>(*this), msg);
+      return message_dispatch_table[index](*this, msg);
     }
 
     //**********************************************
@@ -987,6 +1497,20 @@ namespace etl
     {
       return (p_parent != nullptr) ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
     }
+
+    //********************************************
+    // This state has no handlers.
+    //********************************************
+    event_handler_t get_event_handler(etl::message_id_t) const ETL_OVERRIDE
+    {
+      return nullptr;
+    }
+
+    //********************************************
+    etl::fsm_state_id_t process_unknown_event(const etl::imessage& message) ETL_OVERRIDE
+    {
+      return static_cast<TDerived*>(this)->on_event_unknown(message);
+    }
   };
 
 #else
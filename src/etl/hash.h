@@ -37,6 +37,13 @@ SOFTWARE.
 
   // The default hash calculation.
   #include "fnv_1.h"
+
+  // Optional 64 bit word hash for byte ranges.
+  // Changes the hash values of strings, string views, spans and other types
+  // hashed as bytes.
+  #if defined(ETL_HASH_USE_WORD_HASH) && ETL_USING_64BIT_TYPES
+    #include "word_hash.h"
+  #endif
   #include "math.h"
   #include "static_assert.h"
   #include "type_traits.h"
@@ -53,6 +60,61 @@ namespace etl
 {
   namespace private_hash
   {
+  #if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The MurmurHash3 64 bit finaliser.
+    /// Spreads every input bit over the whole result, for users that derive
+    /// indexes from a hash that may be weak, such as the identity.
+    //*************************************************************************
+    inline uint64_t murmur3_finalise_64(uint64_t h)
+    {
+      h ^= h >> 33U;
+      h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 33U;
+      h *= 0xC4CEB9FE1A85EC53ULL;
+      h ^= h >> 33U;
+
+      return h;
+    }
+  #endif
+
+  #if defined(ETL_HASH_USE_WORD_HASH) && ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Hash to use when size_t is 16 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::word_hash(begin, end);
+
+      h ^= (h >> 32U);
+
+      return static_cast<size_t>(h ^ (h >> 16U));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 32 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = etl::word_hash(begin, end);
+
+      return static_cast<size_t>(h ^ (h >> 32U));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 64 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return static_cast<size_t>(etl::word_hash(begin, end));
+    }
+  #else
     //*************************************************************************
     /// Hash to use when size_t is 16 bits.
     /// T is always expected to be size_t.
@@ -75,7 +137,7 @@ namespace etl
       return fnv_1a_32(begin, end);
     }
 
-  #if ETL_USING_64BIT_TYPES
+    #if ETL_USING_64BIT_TYPES
     //*************************************************************************
     /// Hash to use when size_t is 64 bits.
     /// T is always expected to be size_t.
@@ -85,6 +147,7 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+    #endif
   #endif
 
     //*************************************************************************
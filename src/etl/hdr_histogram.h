@@ -0,0 +1,594 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HDR_HISTOGRAM_INCLUDED
+#define ETL_HDR_HISTOGRAM_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup hdr_histogram hdr_histogram
+/// Log-linear histograms, for values that span many orders of magnitude,
+/// such as latencies.
+///\ingroup containers
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_hdr_histogram
+  {
+    //*************************************************************************
+    /// The mapping between values and buckets.
+    /// Values below 2^Significant_Bits have a bucket each. Above that, each
+    /// power of 2 is split into 2^(Significant_Bits - 1) equal buckets, so the
+    /// width of a bucket is never more than 2^-(Significant_Bits - 1) of the
+    /// values in it.
+    //*************************************************************************
+    template <size_t Significant_Bits, size_t Max_Exponent>
+    struct layout
+    {
+      ETL_STATIC_ASSERT((Significant_Bits > 0U) && (Significant_Bits <= Max_Exponent), "Significant_Bits must be 1 to Max_Exponent");
+      ETL_STATIC_ASSERT(Max_Exponent <= 64U, "Max_Exponent must be no more than 64");
+      ETL_STATIC_ASSERT(Significant_Bits < 64U, "Significant_Bits must be less than 64");
+      ETL_STATIC_ASSERT(Significant_Bits <= etl::integral_limits<size_t>::bits, "Significant_Bits is too large for the bucket index");
+
+      static ETL_CONSTANT size_t Half_Buckets = size_t(1U) << (Significant_Bits - 1U);
+
+      static ETL_CONSTANT size_t Number_Of_Buckets = (Max_Exponent - Significant_Bits + 2U) * Half_Buckets;
+
+      static ETL_CONSTANT uint64_t Max_Trackable_Value =
+        (Max_Exponent == 64U) ? etl::integral_limits<uint64_t>::max : ((uint64_t(1U) << (Max_Exponent % 64U)) - 1U);
+
+      //***********************************
+      /// The index of the bucket for the value.
+      /// Values above Max_Trackable_Value go in the last bucket.
+      //***********************************
+      static size_t index_of(uint64_t value)
+      {
+        if (value > Max_Trackable_Value)
+        {
+          value = Max_Trackable_Value;
+        }
+
+        if (value < (uint64_t(1U) << Significant_Bits))
+        {
+          return static_cast<size_t>(value);
+        }
+
+        const size_t msb   = 63U - etl::count_leading_zeros(value);
+        const size_t shift = msb - Significant_Bits + 1U;
+
+        return (shift * Half_Buckets) + static_cast<size_t>(value >> shift);
+      }
+
+      //***********************************
+      /// The lowest value that maps to the bucket.
+      //***********************************
+      static uint64_t lowest_value(size_t index)
+      {
+        if (index < (size_t(2U) * Half_Buckets))
+        {
+          return index;
+        }
+
+        const size_t shift    = (index / Half_Buckets) - 1U;
+        const size_t mantissa = Half_Buckets + (index % Half_Buckets);
+
+        return uint64_t(mantissa) << shift;
+      }
+
+      //***********************************
+      /// The highest value that maps to the bucket.
+      //***********************************
+      static uint64_t highest_value(size_t index)
+      {
+        if (index == (Number_Of_Buckets - 1U))
+        {
+          return Max_Trackable_Value;
+        }
+
+        return lowest_value(index + 1U) - 1U;
+      }
+    };
+
+    template <size_t Significant_Bits, size_t Max_Exponent>
+    ETL_CONSTANT size_t layout<Significant_Bits, Max_Exponent>::Half_Buckets;
+
+    template <size_t Significant_Bits, size_t Max_Exponent>
+    ETL_CONSTANT size_t layout<Significant_Bits, Max_Exponent>::Number_Of_Buckets;
+
+    template <size_t Significant_Bits, size_t Max_Exponent>
+    ETL_CONSTANT uint64_t layout<Significant_Bits, Max_Exponent>::Max_Trackable_Value;
+
+    //*************************************************************************
+    /// Returns sum + (value * count), saturated at the largest uint64_t.
+    //*************************************************************************
+    inline uint64_t saturating_add_product(uint64_t sum, uint64_t value, uint64_t count)
+    {
+      const uint64_t maximum = etl::integral_limits<uint64_t>::max;
+
+      if ((value != 0U) && (count > ((maximum - sum) / value)))
+      {
+        return maximum;
+      }
+
+      return sum + (value * count);
+    }
+  } // namespace private_hdr_histogram
+
+  //***************************************************************************
+  /// A log-linear histogram, in the style of HdrHistogram.
+  /// Records unsigned values up to 2^Max_Exponent - 1 with a relative error of
+  /// no more than 2^-(Significant_Bits - 1), in O(1).
+  /// For example, Significant_Bits of 7 and Max_Exponent of 40 record
+  /// nanosecond latencies up to 18 minutes to within 1.6%, in 2240 buckets.
+  /// Instances may be merged, so each thread may record into its own and the
+  /// results combined.
+  /// Values above Max_Trackable_Value are recorded as Max_Trackable_Value.
+  /// The sum of the values saturates at 2^64 - 1, after which mean() is too
+  /// small.
+  ///\tparam Significant_Bits The number of significant bits kept for a value, 1 to 63.
+  ///\tparam Max_Exponent     Values up to 2^Max_Exponent - 1 may be recorded.
+  ///\tparam TCount           The type of the bucket counts.
+  ///\ingroup hdr_histogram
+  //***************************************************************************
+  template <size_t Significant_Bits, size_t Max_Exponent, typename TCount = uint32_t>
+  class hdr_histogram
+  {
+  private:
+
+    typedef private_hdr_histogram::layout<Significant_Bits, Max_Exponent> layout_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value && etl::is_unsigned<TCount>::value, "TCount must be an unsigned integral type");
+
+    typedef uint64_t value_type;
+    typedef TCount   count_type;
+
+    static ETL_CONSTANT size_t   Number_Of_Buckets   = layout_t::Number_Of_Buckets;
+    static ETL_CONSTANT uint64_t Max_Trackable_Value = layout_t::Max_Trackable_Value;
+
+    //*************************************************************************
+    /// Constructor. The histogram is empty.
+    //*************************************************************************
+    hdr_histogram()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the histogram.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Number_Of_Buckets; ++i)
+      {
+        counts[i] = 0U;
+      }
+
+      total     = 0U;
+      sum       = 0U;
+      min_value = etl::integral_limits<uint64_t>::max;
+      max_value = 0U;
+    }
+
+    //*************************************************************************
+    /// Records a value. Values above Max_Trackable_Value are recorded as
+    /// Max_Trackable_Value.
+    //*************************************************************************
+    void record(value_type value)
+    {
+      record(value, 1U);
+    }
+
+    //*************************************************************************
+    /// Records a number of occurrences of a value.
+    //*************************************************************************
+    void record(value_type value, count_type count)
+    {
+      if (value > Max_Trackable_Value)
+      {
+        value = Max_Trackable_Value;
+      }
+
+      counts[layout_t::index_of(value)] += count;
+
+      total += count;
+      sum = private_hdr_histogram::saturating_add_product(sum, value, count);
+
+      if (value < min_value)
+      {
+        min_value = value;
+      }
+
+      if (value > max_value)
+      {
+        max_value = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Records a value.
+    //*************************************************************************
+    void operator()(value_type value)
+    {
+      record(value, 1U);
+    }
+
+    //*************************************************************************
+    /// Adds the counts of another histogram to this one.
+    //*************************************************************************
+    void merge(const hdr_histogram& other)
+    {
+      for (size_t i = 0U; i < Number_Of_Buckets; ++i)
+      {
+        counts[i] += other.counts[i];
+      }
+
+      total += other.total;
+      sum = private_hdr_histogram::saturating_add_product(sum, other.sum, 1U);
+
+      if (other.min_value < min_value)
+      {
+        min_value = other.min_value;
+      }
+
+      if (other.max_value > max_value)
+      {
+        max_value = other.max_value;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the value at the percentile.
+    /// This is the highest value that is equivalent to the bucket that
+    /// contains the percentile, limited to the largest value recorded.
+    ///\param percentile The percentile. Range 0 to 100. Values outside of the
+    /// range, and NaN, are limited to it.
+    ///\return The value, or 0 if the histogram is empty.
+    //*************************************************************************
+    value_type value_at_percentile(double percentile) const
+    {
+      if (total == 0U)
+      {
+        return 0U;
+      }
+
+      if (!(percentile > 0.0))
+      {
+        percentile = 0.0;
+      }
+      else if (percentile > 100.0)
+      {
+        percentile = 100.0;
+      }
+
+      // The number of values at or below the percentile. At least one.
+      uint64_t target = static_cast<uint64_t>(((percentile / 100.0) * static_cast<double>(total)) + 0.5);
+
+      if (target == 0U)
+      {
+        target = 1U;
+      }
+
+      uint64_t running = 0U;
+
+      for (size_t i = 0U; i < Number_Of_Buckets; ++i)
+      {
+        running += counts[i];
+
+        if (running >= target)
+        {
+          const uint64_t highest = layout_t::highest_value(i);
+
+          return (highest < max_value) ? highest : max_value;
+        }
+      }
+
+      return max_value;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values recorded at or below the value.
+    //*************************************************************************
+    uint64_t count_at_or_below(value_type value) const
+    {
+      const size_t last = layout_t::index_of(value);
+
+      uint64_t running = 0U;
+
+      for (size_t i = 0U; i <= last; ++i)
+      {
+        running += counts[i];
+      }
+
+      return running;
+    }
+
+    //*************************************************************************
+    /// Returns the count in the bucket.
+    //*************************************************************************
+    count_type bucket_count(size_t index) const
+    {
+      return counts[index];
+    }
+
+    //*************************************************************************
+    /// Returns the lowest value that is recorded in the bucket.
+    //*************************************************************************
+    static value_type bucket_lowest_value(size_t index)
+    {
+      return layout_t::lowest_value(index);
+    }
+
+    //*************************************************************************
+    /// Returns the highest value that is recorded in the bucket.
+    //*************************************************************************
+    static value_type bucket_highest_value(size_t index)
+    {
+      return layout_t::highest_value(index);
+    }
+
+    //*************************************************************************
+    /// Returns the index of the bucket for the value.
+    //*************************************************************************
+    static size_t bucket_index(value_type value)
+    {
+      return layout_t::index_of(value);
+    }
+
+    //*************************************************************************
+    /// Returns the number of buckets.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t size()
+    {
+      return Number_Of_Buckets;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values recorded.
+    //*************************************************************************
+    uint64_t count() const
+    {
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns the smallest value recorded, or 0 if the histogram is empty.
+    //*************************************************************************
+    value_type min() const
+    {
+      return (total == 0U) ? 0U : min_value;
+    }
+
+    //*************************************************************************
+    /// Returns the largest value recorded, or 0 if the histogram is empty.
+    //*************************************************************************
+    value_type max() const
+    {
+      return max_value;
+    }
+
+    //*************************************************************************
+    /// Returns the mean of the values recorded, or 0 if the histogram is empty.
+    //*************************************************************************
+    double mean() const
+    {
+      return (total == 0U) ? 0.0 : static_cast<double>(sum) / static_cast<double>(total);
+    }
+
+  private:
+
+#if ETL_HAS_ATOMIC
+    template <size_t, size_t, typename>
+    friend class atomic_hdr_histogram;
+#endif
+
+    count_type counts[Number_Of_Buckets];
+    uint64_t   total;
+    uint64_t   sum;
+    value_type min_value;
+    value_type max_value;
+  };
+
+  template <size_t Significant_Bits, size_t Max_Exponent, typename TCount>
+  ETL_CONSTANT size_t hdr_histogram<Significant_Bits, Max_Exponent, TCount>::Number_Of_Buckets;
+
+  template <size_t Significant_Bits, size_t Max_Exponent, typename TCount>
+  ETL_CONSTANT uint64_t hdr_histogram<Significant_Bits, Max_Exponent, TCount>::Max_Trackable_Value;
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A log-linear histogram that may be recorded into from several threads
+  /// at once, without locks.
+  /// Each record is a relaxed atomic increment of one bucket, plus the
+  /// updates of the summary values. Readers take a snapshot into an
+  /// etl::hdr_histogram, which is consistent per bucket but not across
+  /// buckets while recording continues.
+  /// Values are limited, and the sum saturated, as for etl::hdr_histogram.
+  ///\tparam Significant_Bits The number of significant bits kept for a value, 1 to 63.
+  ///\tparam Max_Exponent     Values up to 2^Max_Exponent - 1 may be recorded.
+  ///\tparam TCount           The type of the bucket counts.
+  ///\ingroup hdr_histogram
+  //***************************************************************************
+  template <size_t Significant_Bits, size_t Max_Exponent, typename TCount = uint32_t>
+  class atomic_hdr_histogram
+  {
+  private:
+
+    typedef private_hdr_histogram::layout<Significant_Bits, Max_Exponent> layout_t;
+
+  public:
+
+    typedef uint64_t                                                    value_type;
+    typedef TCount                                                      count_type;
+    typedef etl::hdr_histogram<Significant_Bits, Max_Exponent, TCount> snapshot_type;
+
+    static ETL_CONSTANT size_t Number_Of_Buckets = layout_t::Number_Of_Buckets;
+
+    //*************************************************************************
+    /// Constructor. The histogram is empty.
+    //*************************************************************************
+    atomic_hdr_histogram()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the histogram.
+    /// Values recorded concurrently may be partly cleared.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Number_Of_Buckets; ++i)
+      {
+        counts[i].store(0U, etl::memory_order_relaxed);
+      }
+
+      total.store(0U, etl::memory_order_relaxed);
+      sum.store(0U, etl::memory_order_relaxed);
+      min_value.store(etl::integral_limits<uint64_t>::max, etl::memory_order_relaxed);
+      max_value.store(0U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Records a value.
+    //*************************************************************************
+    void record(value_type value)
+    {
+      record(value, 1U);
+    }
+
+    //*************************************************************************
+    /// Records a number of occurrences of a value.
+    //*************************************************************************
+    void record(value_type value, count_type count)
+    {
+      if (value > layout_t::Max_Trackable_Value)
+      {
+        value = layout_t::Max_Trackable_Value;
+      }
+
+      counts[layout_t::index_of(value)].fetch_add(count, etl::memory_order_relaxed);
+
+      total.fetch_add(count, etl::memory_order_relaxed);
+
+      uint64_t current = sum.load(etl::memory_order_relaxed);
+
+      while (!sum.compare_exchange_weak(current, private_hdr_histogram::saturating_add_product(current, value, count), etl::memory_order_relaxed))
+      {
+      }
+
+      current = min_value.load(etl::memory_order_relaxed);
+
+      while ((value < current) && !min_value.compare_exchange_weak(current, value, etl::memory_order_relaxed))
+      {
+      }
+
+      current = max_value.load(etl::memory_order_relaxed);
+
+      while ((value > current) && !max_value.compare_exchange_weak(current, value, etl::memory_order_relaxed))
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// Records a value.
+    //*************************************************************************
+    void operator()(value_type value)
+    {
+      record(value, 1U);
+    }
+
+    //*************************************************************************
+    /// Copies the current state into a histogram, for querying.
+    //*************************************************************************
+    void snapshot(snapshot_type& destination) const
+    {
+      for (size_t i = 0U; i < Number_Of_Buckets; ++i)
+      {
+        destination.counts[i] = counts[i].load(etl::memory_order_relaxed);
+      }
+
+      destination.total     = total.load(etl::memory_order_relaxed);
+      destination.sum       = sum.load(etl::memory_order_relaxed);
+      destination.min_value = min_value.load(etl::memory_order_relaxed);
+      destination.max_value = max_value.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Adds the current state to a histogram.
+    //*************************************************************************
+    void merge_into(snapshot_type& destination) const
+    {
+      snapshot_type temp;
+
+      snapshot(temp);
+      destination.merge(temp);
+    }
+
+    //*************************************************************************
+    /// Returns the number of values recorded.
+    //*************************************************************************
+    uint64_t count() const
+    {
+      return total.load(etl::memory_order_relaxed);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    atomic_hdr_histogram(const atomic_hdr_histogram&) ETL_DELETE;
+    atomic_hdr_histogram& operator=(const atomic_hdr_histogram&) ETL_DELETE;
+
+    etl::atomic<count_type> counts[Number_Of_Buckets];
+    etl::atomic<uint64_t>   total;
+    etl::atomic<uint64_t>   sum;
+    etl::atomic<uint64_t>   min_value;
+    etl::atomic<uint64_t>   max_value;
+  };
+
+  template <size_t Significant_Bits, size_t Max_Exponent, typename TCount>
+  ETL_CONSTANT size_t atomic_hdr_histogram<Significant_Bits, Max_Exponent, TCount>::Number_Of_Buckets;
+#endif
+} // namespace etl
+
+#endif
+
+#endif
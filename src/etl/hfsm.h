@@ -94,6 +94,8 @@ namespace etl
             }
           }
         }
+
+        trace_state_change(ifsm_state::No_State_Change);
       }
     }
 
@@ -111,7 +113,11 @@ namespace etl
         do_exits(ETL_NULLPTR, p_state);
       }
 
+      const etl::fsm_state_id_t previous_state_id = is_started() ? p_state->get_state_id() : ifsm_state::No_State_Change;
+
       p_state = ETL_NULLPTR;
+
+      trace_state_change(previous_state_id);
     }
 
   private:
@@ -0,0 +1,774 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HIERARCHICAL_BITSET_INCLUDED
+#define ETL_HIERARCHICAL_BITSET_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup hierarchical_bitset hierarchical_bitset
+/// A bitset with summary levels, so that the first set or clear bit may be
+/// found in a few word lookups, whatever the size of the bitset.
+///\ingroup containers
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for hierarchical bitsets
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  class hierarchical_bitset_exception : public etl::exception
+  {
+  public:
+
+    hierarchical_bitset_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Hierarchical bitset overflow exception.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  class hierarchical_bitset_overflow : public hierarchical_bitset_exception
+  {
+  public:
+
+    hierarchical_bitset_overflow(string_type file_name_, numeric_type line_number_)
+      : hierarchical_bitset_exception(ETL_ERROR_TEXT("hierarchical_bitset:overflow", ETL_HIERARCHICAL_BITSET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A bitset of 64 bit words, with two levels of summary words above them.
+  /// Each summary level records which of the words below it have any bit set,
+  /// and which have any bit clear. The first set or clear bit at or after a
+  /// position is found with at most three word lookups on each level, plus a
+  /// linear scan of the top level for bitsets larger than 262144 bits.
+  /// The summaries are updated on every modification, which costs two extra
+  /// word writes for each word that changes.
+  ///\tparam Active_Bits The number of bits.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  template <size_t Active_Bits>
+  class hierarchical_bitset
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Active_Bits > 0U, "The bitset must have at least one bit");
+
+    typedef uint64_t element_type;
+
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    static ETL_CONSTANT size_t Bits_Per_Element = 64U;
+
+    /// The number of words of bits.
+    static ETL_CONSTANT size_t Number_Of_Elements = (Active_Bits + Bits_Per_Element - 1U) / Bits_Per_Element;
+
+    /// The number of words in the first summary level.
+    static ETL_CONSTANT size_t Number_Of_Summary_Elements = (Number_Of_Elements + Bits_Per_Element - 1U) / Bits_Per_Element;
+
+    /// The number of words in the top summary level.
+    static ETL_CONSTANT size_t Number_Of_Top_Elements = (Number_Of_Summary_Elements + Bits_Per_Element - 1U) / Bits_Per_Element;
+
+    /// The mask of the valid bits in the last word.
+    static ETL_CONSTANT element_type Top_Mask =
+      ((Active_Bits % Bits_Per_Element) == 0U) ? ~element_type(0U) : (element_type(1U) << (Active_Bits % Bits_Per_Element)) - 1U;
+
+    //*************************************************************************
+    /// Default constructor. All bits are clear.
+    //*************************************************************************
+    hierarchical_bitset()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Set all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& set()
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] = ~element_type(0U);
+      }
+
+      words[Number_Of_Elements - 1U] = Top_Mask;
+      bit_count                      = Active_Bits;
+
+      occupied.fill();
+      vacant.clear();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& set(size_t position, bool value = true)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(position < Active_Bits, ETL_ERROR(hierarchical_bitset_overflow), *this);
+
+      const size_t       index = position / Bits_Per_Element;
+      const element_type mask  = element_type(1U) << (position % Bits_Per_Element);
+
+      assign_word(index, value ? (words[index] | mask) : (words[index] & ~mask));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set the range of bits.
+    ///\param position The first bit of the range.
+    ///\param length   The number of bits in the range.
+    //*************************************************************************
+    hierarchical_bitset& set_range(size_t position, size_t length)
+    {
+      assign_range(position, length, true);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& reset()
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] = element_type(0U);
+      }
+
+      bit_count = 0U;
+
+      occupied.clear();
+      vacant.fill();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& reset(size_t position)
+    {
+      return set(position, false);
+    }
+
+    //*************************************************************************
+    /// Reset the range of bits.
+    ///\param position The first bit of the range.
+    ///\param length   The number of bits in the range.
+    //*************************************************************************
+    hierarchical_bitset& reset_range(size_t position, size_t length)
+    {
+      assign_range(position, length, false);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flip all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& flip()
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] = ~words[i];
+      }
+
+      words[Number_Of_Elements - 1U] &= Top_Mask;
+      bit_count = Active_Bits - bit_count;
+
+      rebuild_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flip the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& flip(size_t position)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(position < Active_Bits, ETL_ERROR(hierarchical_bitset_overflow), *this);
+
+      const size_t index = position / Bits_Per_Element;
+
+      assign_word(index, words[index] ^ (element_type(1U) << (position % Bits_Per_Element)));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Tests the bit at the position.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(position < Active_Bits, ETL_ERROR(hierarchical_bitset_overflow), false);
+
+      return (words[position / Bits_Per_Element] & (element_type(1U) << (position % Bits_Per_Element))) != 0U;
+    }
+
+    //*************************************************************************
+    /// Read [] operator.
+    //*************************************************************************
+    bool operator[](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// The number of bits in the bitset.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t size() ETL_NOEXCEPT
+    {
+      return Active_Bits;
+    }
+
+    //*************************************************************************
+    /// The number of set bits. Maintained incrementally.
+    //*************************************************************************
+    size_t count() const ETL_NOEXCEPT
+    {
+      return bit_count;
+    }
+
+    //*************************************************************************
+    /// Are all of the bits set?
+    //*************************************************************************
+    bool all() const ETL_NOEXCEPT
+    {
+      return bit_count == Active_Bits;
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const ETL_NOEXCEPT
+    {
+      return bit_count != 0U;
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const ETL_NOEXCEPT
+    {
+      return bit_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_first(bool state) const ETL_NOEXCEPT
+    {
+      return find_next(state, 0U);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_next(bool state, size_t position) const ETL_NOEXCEPT
+    {
+      if (position >= Active_Bits)
+      {
+        return npos;
+      }
+
+      // Try the rest of the word that contains the position.
+      size_t       index = position / Bits_Per_Element;
+      element_type value = word_in_state(index, state) & (~element_type(0U) << (position % Bits_Per_Element));
+
+      if (value == 0U)
+      {
+        // Ask the summaries for the next word with a bit in the state.
+        index = (state ? occupied : vacant).find_next(index + 1U);
+
+        if (index == npos)
+        {
+          return npos;
+        }
+
+        value = word_in_state(index, state);
+      }
+
+      return (index * Bits_Per_Element) + etl::count_trailing_zeros(value);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order. Words with no bits set are skipped using the summaries.
+    ///\param function The function to call, as <b>void(size_t)</b>.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_set_bit(TFunction function) const
+    {
+      size_t index = occupied.find_next(0U);
+
+      while (index != npos)
+      {
+        element_type value = words[index];
+
+        while (value != 0U)
+        {
+          function((index * Bits_Per_Element) + etl::count_trailing_zeros(value));
+
+          // Clear the lowest set bit.
+          value &= value - 1U;
+        }
+
+        index = occupied.find_next(index + 1U);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// operator &=
+    //*************************************************************************
+    hierarchical_bitset& operator&=(const hierarchical_bitset& other)
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] &= other.words[i];
+      }
+
+      recount();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// operator |=
+    //*************************************************************************
+    hierarchical_bitset& operator|=(const hierarchical_bitset& other)
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] |= other.words[i];
+      }
+
+      recount();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// operator ^=
+    //*************************************************************************
+    hierarchical_bitset& operator^=(const hierarchical_bitset& other)
+    {
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        words[i] ^= other.words[i];
+      }
+
+      recount();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// operator &
+    //*************************************************************************
+    hierarchical_bitset operator&(const hierarchical_bitset& other) const
+    {
+      hierarchical_bitset temp(*this);
+
+      temp &= other;
+
+      return temp;
+    }
+
+    //*************************************************************************
+    /// operator |
+    //*************************************************************************
+    hierarchical_bitset operator|(const hierarchical_bitset& other) const
+    {
+      hierarchical_bitset temp(*this);
+
+      temp |= other;
+
+      return temp;
+    }
+
+    //*************************************************************************
+    /// operator ^
+    //*************************************************************************
+    hierarchical_bitset operator^(const hierarchical_bitset& other) const
+    {
+      hierarchical_bitset temp(*this);
+
+      temp ^= other;
+
+      return temp;
+    }
+
+    //*************************************************************************
+    /// operator ~
+    //*************************************************************************
+    hierarchical_bitset operator~() const
+    {
+      hierarchical_bitset temp(*this);
+
+      temp.flip();
+
+      return temp;
+    }
+
+    //*************************************************************************
+    /// operator ==
+    //*************************************************************************
+    friend bool operator==(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      if (lhs.bit_count != rhs.bit_count)
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        if (lhs.words[i] != rhs.words[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// operator !=
+    //*************************************************************************
+    friend bool operator!=(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    //*************************************************************************
+    /// swap
+    //*************************************************************************
+    void swap(hierarchical_bitset& other)
+    {
+      using ETL_OR_STD::swap;
+
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        swap(words[i], other.words[i]);
+      }
+
+      swap(bit_count, other.bit_count);
+
+      occupied.swap(other.occupied);
+      vacant.swap(other.vacant);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Two levels of summary bits, one bit per word on the level below.
+    //*************************************************************************
+    class summary
+    {
+    public:
+
+      //*********************************
+      void clear()
+      {
+        for (size_t i = 0U; i < Number_Of_Summary_Elements; ++i)
+        {
+          level1[i] = element_type(0U);
+        }
+
+        for (size_t i = 0U; i < Number_Of_Top_Elements; ++i)
+        {
+          level2[i] = element_type(0U);
+        }
+      }
+
+      //*********************************
+      void fill()
+      {
+        clear();
+
+        for (size_t i = 0U; i < Number_Of_Elements; ++i)
+        {
+          level1[i / Bits_Per_Element] |= element_type(1U) << (i % Bits_Per_Element);
+        }
+
+        for (size_t i = 0U; i < Number_Of_Summary_Elements; ++i)
+        {
+          level2[i / Bits_Per_Element] |= element_type(1U) << (i % Bits_Per_Element);
+        }
+      }
+
+      //*********************************
+      void assign(size_t index, bool value)
+      {
+        const size_t       index1 = index / Bits_Per_Element;
+        const element_type mask1  = element_type(1U) << (index % Bits_Per_Element);
+        const element_type mask2  = element_type(1U) << (index1 % Bits_Per_Element);
+
+        if (value)
+        {
+          level1[index1] |= mask1;
+          level2[index1 / Bits_Per_Element] |= mask2;
+        }
+        else
+        {
+          level1[index1] &= ~mask1;
+
+          if (level1[index1] == 0U)
+          {
+            level2[index1 / Bits_Per_Element] &= ~mask2;
+          }
+        }
+      }
+
+      //*********************************
+      /// Finds the index of the first word, at or after 'index', that is
+      /// marked in the summary.
+      //*********************************
+      size_t find_next(size_t index) const
+      {
+        if (index >= Number_Of_Elements)
+        {
+          return npos;
+        }
+
+        size_t       index1 = index / Bits_Per_Element;
+        element_type value  = level1[index1] & (~element_type(0U) << (index % Bits_Per_Element));
+
+        if (value == 0U)
+        {
+          ++index1;
+
+          if (index1 >= Number_Of_Summary_Elements)
+          {
+            return npos;
+          }
+
+          size_t index2 = index1 / Bits_Per_Element;
+          value         = level2[index2] & (~element_type(0U) << (index1 % Bits_Per_Element));
+
+          // Only scans for bitsets with more than one top level word.
+          while (value == 0U)
+          {
+            if (++index2 >= Number_Of_Top_Elements)
+            {
+              return npos;
+            }
+
+            value = level2[index2];
+          }
+
+          index1 = (index2 * Bits_Per_Element) + etl::count_trailing_zeros(value);
+          value  = level1[index1];
+        }
+
+        return (index1 * Bits_Per_Element) + etl::count_trailing_zeros(value);
+      }
+
+      //*********************************
+      void swap(summary& other)
+      {
+        using ETL_OR_STD::swap;
+
+        for (size_t i = 0U; i < Number_Of_Summary_Elements; ++i)
+        {
+          swap(level1[i], other.level1[i]);
+        }
+
+        for (size_t i = 0U; i < Number_Of_Top_Elements; ++i)
+        {
+          swap(level2[i], other.level2[i]);
+        }
+      }
+
+    private:
+
+      element_type level1[Number_Of_Summary_Elements];
+      element_type level2[Number_Of_Top_Elements];
+    };
+
+    //*************************************************************************
+    /// The mask of the valid bits in the word at the index.
+    //*************************************************************************
+    static element_type valid_mask(size_t index)
+    {
+      return (index == (Number_Of_Elements - 1U)) ? Top_Mask : ~element_type(0U);
+    }
+
+    //*************************************************************************
+    /// Returns the word with the bits in the state set.
+    //*************************************************************************
+    element_type word_in_state(size_t index, bool state) const
+    {
+      return state ? words[index] : (~words[index] & valid_mask(index));
+    }
+
+    //*************************************************************************
+    /// Replaces the word at the index and updates the count and summaries.
+    //*************************************************************************
+    void assign_word(size_t index, element_type value)
+    {
+      const element_type old_value = words[index];
+
+      if (value != old_value)
+      {
+        words[index] = value;
+        bit_count    = bit_count + etl::count_bits(value) - etl::count_bits(old_value);
+
+        occupied.assign(index, value != 0U);
+        vacant.assign(index, value != valid_mask(index));
+      }
+    }
+
+    //*************************************************************************
+    /// Sets or resets a range of bits, a word at a time.
+    //*************************************************************************
+    void assign_range(size_t position, size_t length, bool value)
+    {
+      if ((position > Active_Bits) || (length > (Active_Bits - position)))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(hierarchical_bitset_overflow));
+        return;
+      }
+
+      while (length != 0U)
+      {
+        const size_t index = position / Bits_Per_Element;
+        const size_t shift = position % Bits_Per_Element;
+        const size_t n     = ((Bits_Per_Element - shift) < length) ? (Bits_Per_Element - shift) : length;
+
+        const element_type mask = ((n == Bits_Per_Element) ? ~element_type(0U) : ((element_type(1U) << n) - 1U)) << shift;
+
+        assign_word(index, value ? (words[index] | mask) : (words[index] & ~mask));
+
+        position += n;
+        length -= n;
+      }
+    }
+
+    //*************************************************************************
+    /// Recalculates the count and the summaries after a whole bitset
+    /// operation.
+    //*************************************************************************
+    void recount()
+    {
+      bit_count = 0U;
+
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        bit_count += etl::count_bits(words[i]);
+      }
+
+      rebuild_summaries();
+    }
+
+    //*************************************************************************
+    /// Recalculates the summaries from the words.
+    //*************************************************************************
+    void rebuild_summaries()
+    {
+      occupied.clear();
+      vacant.clear();
+
+      for (size_t i = 0U; i < Number_Of_Elements; ++i)
+      {
+        if (words[i] != 0U)
+        {
+          occupied.assign(i, true);
+        }
+
+        if (words[i] != valid_mask(i))
+        {
+          vacant.assign(i, true);
+        }
+      }
+    }
+
+    element_type words[Number_Of_Elements];
+    size_t       bit_count;
+    summary      occupied; ///< Words with at least one bit set.
+    summary      vacant;   ///< Words with at least one bit clear.
+  };
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::npos;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Bits_Per_Element;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Number_Of_Elements;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Number_Of_Summary_Elements;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Number_Of_Top_Elements;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT typename hierarchical_bitset<Active_Bits>::element_type hierarchical_bitset<Active_Bits>::Top_Mask;
+
+  //***************************************************************************
+  /// swap
+  //***************************************************************************
+  template <size_t Active_Bits>
+  void swap(etl::hierarchical_bitset<Active_Bits>& lhs, etl::hierarchical_bitset<Active_Bits>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+} // namespace etl
+
+#endif
+
+#endif
@@ -0,0 +1,255 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEX_ALLOCATOR_INCLUDED
+#define ETL_INDEX_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "hierarchical_bitset.h"
+
+#include <stddef.h>
+
+///\defgroup index_allocator index_allocator
+/// Allocates and releases integer IDs in the range 0 to N - 1.
+///\ingroup containers
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for index_allocator exceptions.
+  ///\ingroup index_allocator
+  //***************************************************************************
+  class index_allocator_exception : public etl::exception
+  {
+  public:
+
+    index_allocator_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when there are no more free IDs.
+  ///\ingroup index_allocator
+  //***************************************************************************
+  class index_allocator_no_allocation : public index_allocator_exception
+  {
+  public:
+
+    index_allocator_no_allocation(string_type file_name_, numeric_type line_number_)
+      : index_allocator_exception(ETL_ERROR_TEXT("index_allocator:allocation", ETL_INDEX_ALLOCATOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an ID is released that is not allocated.
+  ///\ingroup index_allocator
+  //***************************************************************************
+  class index_allocator_not_allocated : public index_allocator_exception
+  {
+  public:
+
+    index_allocator_not_allocated(string_type file_name_, numeric_type line_number_)
+      : index_allocator_exception(ETL_ERROR_TEXT("index_allocator:not allocated", ETL_INDEX_ALLOCATOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Allocates integer IDs from 0 to Max_Size - 1, lowest free ID first.
+  /// Allocation and release cost a few word operations, whatever the number
+  /// of IDs, as the free IDs are tracked with an etl::hierarchical_bitset.
+  ///\tparam Max_Size The number of IDs.
+  ///\ingroup index_allocator
+  //***************************************************************************
+  template <size_t Max_Size_>
+  class index_allocator
+  {
+  public:
+
+    static ETL_CONSTANT size_t Max_Size = Max_Size_;
+
+    static ETL_CONSTANT size_t npos = etl::hierarchical_bitset<Max_Size_>::npos;
+
+    //*************************************************************************
+    /// Default constructor. All IDs are free.
+    //*************************************************************************
+    index_allocator()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates the lowest free ID.
+    /// If there are no free IDs then an etl::index_allocator_no_allocation is
+    /// raised, and npos is returned.
+    //*************************************************************************
+    size_t allocate()
+    {
+      const size_t id = allocated.find_first(false);
+
+      if (id == npos)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(index_allocator_no_allocation));
+        return npos;
+      }
+
+      allocated.set(id);
+
+      return id;
+    }
+
+    //*************************************************************************
+    /// Allocates a particular ID, if it is free.
+    ///\returns <b>true</b> if the ID was allocated.
+    //*************************************************************************
+    bool allocate(size_t id)
+    {
+      if ((id >= Max_Size) || allocated.test(id))
+      {
+        return false;
+      }
+
+      allocated.set(id);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Releases an ID.
+    /// If the ID is not allocated then an etl::index_allocator_not_allocated
+    /// is raised.
+    //*************************************************************************
+    void release(size_t id)
+    {
+      if (!is_allocated(id))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(index_allocator_not_allocated));
+        return;
+      }
+
+      allocated.reset(id);
+    }
+
+    //*************************************************************************
+    /// Releases all of the IDs.
+    //*************************************************************************
+    void release_all()
+    {
+      allocated.reset();
+    }
+
+    //*************************************************************************
+    /// Checks whether an ID is allocated.
+    //*************************************************************************
+    bool is_allocated(size_t id) const
+    {
+      return (id < Max_Size) && allocated.test(id);
+    }
+
+    //*************************************************************************
+    /// Calls the function with each allocated ID, in ascending order.
+    ///\param function The function to call, as <b>void(size_t)</b>.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_allocated(TFunction function) const
+    {
+      return allocated.for_each_set_bit(function);
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated IDs.
+    //*************************************************************************
+    size_t size() const
+    {
+      return allocated.count();
+    }
+
+    //*************************************************************************
+    /// Returns the number of free IDs.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - allocated.count();
+    }
+
+    //*************************************************************************
+    /// Returns the number of IDs.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_size()
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of IDs.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity()
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Checks if no IDs are allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return allocated.none();
+    }
+
+    //*************************************************************************
+    /// Checks if all of the IDs are allocated.
+    //*************************************************************************
+    bool full() const
+    {
+      return allocated.all();
+    }
+
+  private:
+
+    etl::hierarchical_bitset<Max_Size_> allocated; ///< Set bits are allocated IDs.
+  };
+
+  template <size_t Max_Size_>
+  ETL_CONSTANT size_t index_allocator<Max_Size_>::Max_Size;
+
+  template <size_t Max_Size_>
+  ETL_CONSTANT size_t index_allocator<Max_Size_>::npos;
+} // namespace etl
+
+#endif
+
+#endif
@@ -447,6 +447,69 @@ namespace etl
       swap->weight           = detached->weight;
     }
 
+    //*************************************************************************
+    /// Flattens the tree below 'position' into an in-order list, linked
+    /// through children[kRight], and prepends it to 'list'.
+    //*************************************************************************
+    static void tree_to_list(Node* position, Node*& list)
+    {
+      while (position != ETL_NULLPTR)
+      {
+        tree_to_list(position->children[kRight], list);
+
+        Node* left = position->children[kLeft];
+
+        position->children[kLeft]  = ETL_NULLPTR;
+        position->children[kRight] = list;
+        list                       = position;
+        position                   = left;
+      }
+    }
+
+    //*************************************************************************
+    /// Builds a perfectly balanced tree from the first 'count' nodes of an
+    /// in-order list, and advances 'list' past them.
+    //*************************************************************************
+    static Node* list_to_tree(Node*& list, size_type count)
+    {
+      if (count == 0U)
+      {
+        return ETL_NULLPTR;
+      }
+
+      // The left subtree takes any odd node.
+      const size_type left_count  = count / 2U;
+      const size_type right_count = count - left_count - 1U;
+
+      Node* left = list_to_tree(list, left_count);
+      Node* node = list;
+      list       = list->children[kRight];
+
+      node->children[kLeft]  = left;
+      node->children[kRight] = list_to_tree(list, right_count);
+
+      node->weight = (tree_height(left_count) > tree_height(right_count)) ? uint_least8_t(kLeft) : uint_least8_t(kNeither);
+      node->dir    = uint_least8_t(kNeither);
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// The height of a tree of 'count' nodes built by list_to_tree.
+    //*************************************************************************
+    static size_type tree_height(size_type count)
+    {
+      size_type height = 0U;
+
+      while (count != 0U)
+      {
+        ++height;
+        count >>= 1U;
+      }
+
+      return height;
+    }
+
     size_type       current_size; ///< The number of the used nodes.
     const size_type CAPACITY;     ///< The maximum size of the map.
     Node*           root_node;    ///< The node that acts as the map root.
@@ -1047,6 +1110,22 @@ namespace etl
       insert(first, last);
     }
 
+    //*********************************************************************
+    /// Assigns a range of values, sorted by strictly increasing key, building a
+    /// perfectly balanced tree in O(N).
+    /// If asserts or exceptions are enabled, emits map_iterator if the range
+    /// is not sorted, or map_full if the map does not have enough free
+    /// space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      initialise();
+      insert(etl::sorted_unique_t(), first, last);
+    }
+
     //*************************************************************************
     /// Clears the map.
     //*************************************************************************
@@ -1319,6 +1398,87 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key.
+    /// The range and the existing elements are merged in a single pass and
+    /// the tree is rebuilt perfectly balanced, in O(N + M), rather than being
+    /// searched and rebalanced for each element.
+    /// Keys already in the map are left unchanged.
+    /// If asserts or exceptions are enabled, emits map_iterator if the range
+    /// is not strictly increasing, or map_full if the new keys will not fit.
+    /// In either case the map is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      Node* list = ETL_NULLPTR;
+      tree_to_list(root_node, list);
+
+      // Count the new keys, and check that the range is strictly increasing.
+      size_type n_new     = 0U;
+      bool      is_sorted = true;
+      Node*     existing  = list;
+
+      for (TIterator itr = first, previous = first; is_sorted && (itr != last); previous = itr, ++itr)
+      {
+        is_sorted = (itr == first) || kcompare(previous->first, itr->first);
+
+        while ((existing != ETL_NULLPTR) && kcompare(data_cast(existing)->value.first, itr->first))
+        {
+          existing = existing->children[kRight];
+        }
+
+        if ((existing == ETL_NULLPTR) || kcompare(itr->first, data_cast(existing)->value.first))
+        {
+          ++n_new;
+        }
+      }
+
+      if (!is_sorted || (n_new > available()))
+      {
+        // Restore the tree.
+        root_node = list_to_tree(list, current_size);
+
+        ETL_ASSERT(is_sorted, ETL_ERROR(map_iterator));
+        ETL_ASSERT(n_new <= available(), ETL_ERROR(map_full));
+        return;
+      }
+
+      // Merge the range into the list.
+      Node*  head = ETL_NULLPTR;
+      Node** tail = &head;
+
+      while (first != last)
+      {
+        if ((list != ETL_NULLPTR) && kcompare(data_cast(list)->value.first, first->first))
+        {
+          // The existing key is less.
+          *tail = list;
+          tail  = &list->children[kRight];
+          list  = list->children[kRight];
+        }
+        else
+        {
+          if ((list == ETL_NULLPTR) || kcompare(first->first, data_cast(list)->value.first))
+          {
+            // The new key is less.
+            Node& node = allocate_data_node(*first);
+            *tail      = &node;
+            tail       = &node.children[kRight];
+          }
+
+          ++first;
+        }
+      }
+
+      *tail = list;
+
+      current_size += n_new;
+      root_node = list_to_tree(head, current_size);
+    }
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
     //*********************************************************************
     /// Emplaces a value to the map.
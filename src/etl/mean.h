@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/pairwise_sum.h"
 
 // #include <math.h>
 #include <stdint.h>
@@ -125,6 +127,18 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a block of values, summed pairwise.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      const size_t length = values.size();
+
+      sum += private_statistics::pairwise_sum<calc_t>(private_statistics::value_term<TInput, calc_t>(values.data()), 0U, length);
+      counter += uint32_t(length);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -144,6 +158,26 @@ namespace etl
       add(first, last);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a block of values.
+    //*********************************
+    void operator()(etl::span<const TInput> values)
+    {
+      add(values);
+    }
+
+    //*********************************
+    /// Merges the values added to another mean.
+    /// Partial results, from separate blocks or threads, may be combined.
+    //*********************************
+    void merge(const mean& other)
+    {
+      sum += other.sum;
+      counter += other.counter;
+      recalculate = true;
+    }
+
     //*********************************
     /// Get the mean.
     //*********************************
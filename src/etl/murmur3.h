@@ -36,6 +36,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "ihash.h"
 #include "iterator.h"
+#include "type_traits.h"
 
 #include <stdint.h>
 
@@ -89,20 +90,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= static_cast<value_type>(static_cast<value_type>(*begin) << (block_fill_count * 8U));
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block            = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -128,19 +116,21 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
+      // Complete any partially filled block.
+      while ((begin != end) && (block_fill_count != 0U))
       {
-        block |= static_cast<value_type>(static_cast<value_type>(*begin) << (block_fill_count * 8U));
+        add_byte(static_cast<value_type>(*begin));
         ++begin;
+      }
 
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block            = 0;
-        }
+      // Whole blocks.
+      add_blocks(begin, end, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
 
-        ++char_count;
+      // Remaining bytes.
+      while (begin != end)
+      {
+        add_byte(static_cast<value_type>(*begin));
+        ++begin;
       }
     }
 
@@ -154,16 +144,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= static_cast<value_type>(static_cast<value_type>(value_) << (block_fill_count * 8U));
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block            = 0;
-      }
-
-      ++char_count;
+      add_byte(static_cast<value_type>(value_));
     }
 
     //*************************************************************************
@@ -185,18 +166,80 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds whole blocks, read directly from a random access range.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_blocks(TIterator& begin, const TIterator end, etl::true_type)
+    {
+      size_t n_blocks = static_cast<size_t>(etl::distance(begin, end)) / FULL_BLOCK;
+
+      char_count += n_blocks * FULL_BLOCK;
+
+      // Accumulate in a local, as stores to the member could alias the input data.
+      value_type h = hash;
+
+      while (n_blocks-- != 0U)
+      {
+        const value_type word = static_cast<value_type>(begin[0])
+                              | static_cast<value_type>(static_cast<value_type>(begin[1]) << 8U)
+                              | static_cast<value_type>(static_cast<value_type>(begin[2]) << 16U)
+                              | static_cast<value_type>(static_cast<value_type>(begin[3]) << 24U);
+
+        h = mix_block(h, word);
+        begin += FULL_BLOCK;
+      }
+
+      hash = h;
+    }
+
+    //*************************************************************************
+    /// Not a random access range. Blocks are added byte by byte.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_blocks(TIterator&, const TIterator, etl::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(value_type value_)
+    {
+      block |= static_cast<value_type>(value_ << (block_fill_count * 8U));
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block            = 0;
+      }
+
+      ++char_count;
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
     void add_block()
     {
-      block *= CONSTANT1;
-      block = rotate_left(block, SHIFT1);
-      block *= CONSTANT2;
+      hash = mix_block(hash, block);
+    }
+
+    //*************************************************************************
+    /// Mixes a block into a hash value.
+    //*************************************************************************
+    static value_type mix_block(value_type hash_, value_type block_)
+    {
+      block_ *= CONSTANT1;
+      block_ = rotate_left(block_, SHIFT1);
+      block_ *= CONSTANT2;
+
+      hash_ ^= block_;
+      hash_ = rotate_left(hash_, SHIFT2);
+      hash_ = (hash_ * MULTIPLY) + ADD;
 
-      hash ^= block;
-      hash = rotate_left(hash, SHIFT2);
-      hash = (hash * MULTIPLY) + ADD;
+      return hash_;
     }
 
     //*************************************************************************
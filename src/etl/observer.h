@@ -52,12 +52,15 @@ SOFTWARE.
 
 #include "platform.h"
 #include "algorithm.h"
+#include "atomic.h"
 #include "error_handler.h"
 #include "exception.h"
 #include "type_list.h"
 #include "utility.h"
 #include "vector.h"
 
+#include <stdint.h>
+
 namespace etl
 {
   //***************************************************************************
@@ -235,6 +238,9 @@ namespace etl
 
     //*****************************************************************
     /// Notify all of the observers, sending them the notification.
+    /// A block of notifications may be sent in one call as an
+    /// etl::span<const T>, if the observer type has it as one of its
+    /// notification types.
     ///\tparam TNotification The notification type.
     ///\param n The notification.
     //*****************************************************************
@@ -291,6 +297,328 @@ namespace etl
     Observer_List observer_list;
   };
 
+#if ETL_HAS_ATOMIC
+  //*********************************************************************
+  /// An observable whose observers may be notified from several threads or
+  /// interrupts at once, while one other thread changes the observers.
+  /// Notifications read an immutable snapshot of the enabled observers, so
+  /// no lock is taken. Each change to the observers writes a new snapshot
+  /// to the spare buffer, publishes it, and then waits until no notification
+  /// is still reading the previous one. When a change returns, the old
+  /// observers will not be called again, so a removed observer may be
+  /// destroyed.
+  /// Observers must not be changed from within a notification, or by a
+  /// context that can preempt a notification, as the change would wait
+  /// for it forever.
+  ///\tparam TObserver     The observer type.
+  ///\tparam Max_Observers The maximum number of observers that can be
+  /// accommodated.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename TObserver, const size_t Max_Observers>
+  class observable_atomic
+  {
+  private:
+
+    //***********************************
+    // Item stored in the observer list.
+    //***********************************
+    struct observer_item
+    {
+      observer_item(TObserver& observer_)
+        : p_observer(&observer_)
+        , enabled(true)
+      {
+      }
+
+      TObserver* p_observer;
+      bool       enabled;
+    };
+
+    //***********************************
+    // How to compare an observer with an observer list item.
+    //***********************************
+    struct compare_observers
+    {
+      compare_observers(TObserver& observer_)
+        : p_observer(&observer_)
+      {
+      }
+
+      bool operator()(const observer_item& item) const
+      {
+        return p_observer == item.p_observer;
+      }
+
+      TObserver* p_observer;
+    };
+
+    //***********************************
+    // The enabled observers, as seen by notifications.
+    //***********************************
+    struct snapshot
+    {
+      TObserver* observers[Max_Observers];
+      size_t     size;
+    };
+
+    //***********************************
+    // Holds a snapshot for the duration of a notification.
+    //***********************************
+    class snapshot_reader
+    {
+    public:
+
+      snapshot_reader(observable_atomic& owner_)
+        : owner(owner_)
+      {
+        // Register as a reader of the current snapshot. If it was replaced
+        // meanwhile, then it may be overwritten, so try again.
+        do {
+          index = owner.current.load();
+          owner.readers[index].fetch_add(1U);
+
+          if (owner.current.load() == index)
+          {
+            break;
+          }
+
+          owner.readers[index].fetch_sub(1U);
+        } while (true);
+      }
+
+      ~snapshot_reader()
+      {
+        owner.readers[index].fetch_sub(1U);
+      }
+
+      const snapshot& get() const
+      {
+        return owner.snapshots[index];
+      }
+
+    private:
+
+      observable_atomic& owner;
+      uint32_t           index;
+    };
+
+  public:
+
+    typedef size_t size_type;
+
+    typedef etl::vector<observer_item, Max_Observers> Observer_List;
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    observable_atomic()
+    {
+      snapshots[0].size = 0U;
+      snapshots[1].size = 0U;
+      current.store(0U);
+      readers[0].store(0U);
+      readers[1].store(0U);
+    }
+
+    //*****************************************************************
+    /// Add an observer to the list.
+    /// If asserts or exceptions are enabled then an
+    /// etl::observable_observer_list_full is emitted if the observer list is
+    /// already full.
+    ///\param observer A reference to the observer.
+    //*****************************************************************
+    void add_observer(TObserver& observer)
+    {
+      // See if we already have it in our list.
+      typename Observer_List::iterator i_observer_item = find_observer(observer);
+
+      // Not there?
+      if (i_observer_item == observer_list.end())
+      {
+        // Is there enough room?
+        ETL_ASSERT_OR_RETURN(!observer_list.full(), ETL_ERROR(etl::observer_list_full));
+
+        // Add it.
+        observer_list.push_back(observer_item(observer));
+
+        publish();
+      }
+    }
+
+    //*****************************************************************
+    /// Remove a particular observer from the list.
+    /// When this returns, the observer will no longer be notified.
+    ///\param observer A reference to the observer.
+    ///\return <b>true</b> if the observer was removed, <b>false</b> if not.
+    //*****************************************************************
+    bool remove_observer(TObserver& observer)
+    {
+      // See if we have it in our list.
+      typename Observer_List::iterator i_observer_item = find_observer(observer);
+
+      // Found it?
+      if (i_observer_item != observer_list.end())
+      {
+        // Erase it.
+        observer_list.erase(i_observer_item);
+
+        publish();
+
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*****************************************************************
+    /// Enable an observer
+    ///\param observer A reference to the observer.
+    ///\param state    <b>true</b> to enable, <b>false</b> to disable. Default
+    /// is enable.
+    //*****************************************************************
+    void enable_observer(TObserver& observer, bool state = true)
+    {
+      // See if we have it in our list.
+      typename Observer_List::iterator i_observer_item = find_observer(observer);
+
+      // Found it?
+      if ((i_observer_item != observer_list.end()) && (i_observer_item->enabled != state))
+      {
+        i_observer_item->enabled = state;
+
+        publish();
+      }
+    }
+
+    //*****************************************************************
+    /// Disable an observer
+    //*****************************************************************
+    void disable_observer(TObserver& observer)
+    {
+      enable_observer(observer, false);
+    }
+
+    //*****************************************************************
+    /// Clear all observers from the list.
+    //*****************************************************************
+    void clear_observers()
+    {
+      observer_list.clear();
+
+      publish();
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    size_type number_of_observers() const
+    {
+      return observer_list.size();
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them the notification.
+    /// May be called from several threads at once.
+    /// A block of notifications may be sent in one call as an
+    /// etl::span<const T>, if the observer type has it as one of its
+    /// notification types.
+    ///\tparam TNotification The notification type.
+    ///\param n The notification.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(TNotification n)
+    {
+      snapshot_reader reader(*this);
+
+      const snapshot& observers = reader.get();
+
+      for (size_t i = 0U; i < observers.size; ++i)
+      {
+        observers.observers[i]->notification(n);
+      }
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them the notification.
+    //*****************************************************************
+    void notify_observers()
+    {
+      snapshot_reader reader(*this);
+
+      const snapshot& observers = reader.get();
+
+      for (size_t i = 0U; i < observers.size; ++i)
+      {
+        observers.observers[i]->notification();
+      }
+    }
+
+  protected:
+
+    ~observable_atomic() {}
+
+  private:
+
+    //*****************************************************************
+    /// Find an observer in the list.
+    /// Returns the end of the list if not found.
+    //*****************************************************************
+    typename Observer_List::iterator find_observer(TObserver& observer_)
+    {
+      return etl::find_if(observer_list.begin(), observer_list.end(), compare_observers(observer_));
+    }
+
+    //*****************************************************************
+    /// Writes the enabled observers to the spare snapshot, makes it the
+    /// current one, and waits until the previous one is no longer read.
+    //*****************************************************************
+    void publish()
+    {
+      const uint32_t previous = current.load();
+      const uint32_t next     = previous ^ 1U;
+
+      // Only a notification that has since backed off can hold the spare.
+      while (readers[next].load() != 0U)
+      {
+      }
+
+      snapshot& s = snapshots[next];
+      s.size      = 0U;
+
+      typename Observer_List::const_iterator i_observer_item = observer_list.begin();
+
+      while (i_observer_item != observer_list.end())
+      {
+        if (i_observer_item->enabled)
+        {
+          s.observers[s.size++] = i_observer_item->p_observer;
+        }
+
+        ++i_observer_item;
+      }
+
+      current.store(next);
+
+      // Wait for the notifications still reading the previous snapshot.
+      while (readers[previous].load() != 0U)
+      {
+      }
+    }
+
+    // Disabled.
+    observable_atomic(const observable_atomic&) ETL_DELETE;
+    observable_atomic& operator=(const observable_atomic&) ETL_DELETE;
+
+    Observer_List         observer_list; ///< The list of observers. Only accessed by the writer.
+    snapshot              snapshots[2];  ///< The current and spare snapshots of the enabled observers.
+    etl::atomic<uint32_t> current;       ///< The index of the current snapshot.
+    etl::atomic<uint32_t> readers[2];    ///< The number of notifications reading each snapshot.
+  };
+#endif
+
 #if ETL_USING_CPP11 && !defined(ETL_OBSERVER_FORCE_CPP03_IMPLEMENTATION)
   template <typename... TTypes>
   class observer;
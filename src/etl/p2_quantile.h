@@ -0,0 +1,370 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_P2_QUANTILE_INCLUDED
+#define ETL_P2_QUANTILE_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "iterator.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_p2_quantile
+  {
+    //***************************************************
+    /// add_insert_iterator
+    /// An output iterator used to add new values.
+    //***************************************************
+    template <typename TP2>
+    class add_insert_iterator : public etl::iterator<ETL_OR_STD::output_iterator_tag, void, void, void, void>
+    {
+    public:
+
+      //***********************************
+      explicit add_insert_iterator(TP2& p2_) ETL_NOEXCEPT
+        : p_p2(&p2_)
+      {
+      }
+
+      //***********************************
+      add_insert_iterator& operator*() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++(int) ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator=(typename TP2::value_type value)
+      {
+        p_p2->add(value);
+        return *this;
+      }
+
+    private:
+
+      TP2* p_p2;
+    };
+  } // namespace private_p2_quantile
+
+  //***************************************************************************
+  /// Estimates a single quantile of a stream in constant memory, with the P²
+  /// algorithm of Jain and Chlamtac.
+  /// Five markers track the minimum, the maximum, the quantile and the points
+  /// half way to it. Their heights are adjusted with piecewise parabolic
+  /// interpolation as values arrive. No values are stored.
+  ///\ingroup maths
+  //***************************************************************************
+  template <typename TInput>
+  class p2_quantile : public etl::unary_function<TInput, void>
+  {
+  public:
+
+    typedef TInput                                           value_type;
+    typedef p2_quantile<TInput>                              this_t;
+    typedef private_p2_quantile::add_insert_iterator<this_t> add_insert_iterator;
+
+    //*********************************
+    /// Constructor.
+    ///\param probability_ The quantile to estimate. Range 0 to 1, so 0.5 is the
+    /// median.
+    //*********************************
+    explicit p2_quantile(double probability_)
+      : probability(probability_)
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    p2_quantile(double probability_, TIterator first, TIterator last)
+      : probability(probability_)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      const double x = double(value);
+
+      // Fill the markers with the first values.
+      if (counter < Number_Of_Markers)
+      {
+        // Insertion sort, as they arrive.
+        size_t i = counter;
+
+        while ((i > 0U) && (heights[i - 1U] > x))
+        {
+          heights[i] = heights[i - 1U];
+          --i;
+        }
+
+        heights[i] = x;
+        ++counter;
+
+        return;
+      }
+
+      ++counter;
+
+      // Find the cell that the value falls into, extending the extremes.
+      size_t cell = 0U;
+
+      if (x < heights[0])
+      {
+        heights[0] = x;
+        cell       = 0U;
+      }
+      else if (x >= heights[Number_Of_Markers - 1U])
+      {
+        heights[Number_Of_Markers - 1U] = x;
+        cell                            = Number_Of_Markers - 2U;
+      }
+      else
+      {
+        cell = 1U;
+
+        while (x >= heights[cell])
+        {
+          ++cell;
+        }
+
+        --cell;
+      }
+
+      // Move the markers above the cell.
+      for (size_t i = cell + 1U; i < Number_Of_Markers; ++i)
+      {
+        ++positions[i];
+      }
+
+      for (size_t i = 0U; i < Number_Of_Markers; ++i)
+      {
+        desired[i] += increments[i];
+      }
+
+      // Adjust the heights of the middle markers, if they are off by one or more.
+      for (size_t i = 1U; i < (Number_Of_Markers - 1U); ++i)
+      {
+        const double offset = desired[i] - double(positions[i]);
+
+        if (((offset >= 1.0) && ((positions[i + 1U] - positions[i]) > 1)) || ((offset <= -1.0) && ((positions[i - 1U] - positions[i]) < -1)))
+        {
+          const int32_t direction = (offset >= 0.0) ? 1 : -1;
+
+          const double height = parabolic(i, direction);
+
+          if ((heights[i - 1U] < height) && (height < heights[i + 1U]))
+          {
+            heights[i] = height;
+          }
+          else
+          {
+            heights[i] = linear(i, direction);
+          }
+
+          positions[i] += direction;
+        }
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Gets an add_insert_iterator for input.
+    //*********************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+    //*********************************
+    /// Get the estimate of the quantile.
+    /// Exact while fewer than five values have been added.
+    //*********************************
+    double get_quantile() const
+    {
+      if (counter == 0U)
+      {
+        return 0.0;
+      }
+
+      if (counter < Number_Of_Markers)
+      {
+        // The nearest rank of the values so far.
+        const size_t index = size_t((probability * double(counter - 1U)) + 0.5);
+
+        return heights[index];
+      }
+
+      return heights[Number_Of_Markers / 2U];
+    }
+
+    //*********************************
+    /// Get the estimate of the quantile.
+    //*********************************
+    operator double() const
+    {
+      return get_quantile();
+    }
+
+    //*********************************
+    /// Get the quantile being estimated.
+    //*********************************
+    double get_probability() const
+    {
+      return probability;
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(counter);
+    }
+
+    //*********************************
+    /// Clear the estimator.
+    //*********************************
+    void clear()
+    {
+      counter = 0U;
+
+      for (size_t i = 0U; i < Number_Of_Markers; ++i)
+      {
+        heights[i]   = 0.0;
+        positions[i] = int32_t(i);
+      }
+
+      desired[0] = 0.0;
+      desired[1] = 2.0 * probability;
+      desired[2] = 4.0 * probability;
+      desired[3] = 2.0 + (2.0 * probability);
+      desired[4] = 4.0;
+
+      increments[0] = 0.0;
+      increments[1] = probability / 2.0;
+      increments[2] = probability;
+      increments[3] = (1.0 + probability) / 2.0;
+      increments[4] = 1.0;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Number_Of_Markers = 5U;
+
+    //*********************************
+    /// Piecewise parabolic prediction of the height of the marker.
+    //*********************************
+    double parabolic(size_t i, int32_t direction) const
+    {
+      const double d      = double(direction);
+      const double n_prev = double(positions[i - 1U]);
+      const double n      = double(positions[i]);
+      const double n_next = double(positions[i + 1U]);
+
+      return heights[i] + (d / (n_next - n_prev)) * (((n - n_prev + d) * (heights[i + 1U] - heights[i]) / (n_next - n)) +
+                                                     ((n_next - n - d) * (heights[i] - heights[i - 1U]) / (n - n_prev)));
+    }
+
+    //*********************************
+    /// Linear prediction of the height of the marker.
+    //*********************************
+    double linear(size_t i, int32_t direction) const
+    {
+      const size_t j = (direction > 0) ? (i + 1U) : (i - 1U);
+
+      return heights[i] + (double(direction) * (heights[j] - heights[i]) / double(positions[j] - positions[i]));
+    }
+
+    double   probability;
+    double   heights[Number_Of_Markers];    ///< The heights of the markers.
+    int32_t  positions[Number_Of_Markers];  ///< The actual positions of the markers, from 0.
+    double   desired[Number_Of_Markers];    ///< The desired positions of the markers.
+    double   increments[Number_Of_Markers]; ///< The increments of the desired positions.
+    uint32_t counter;
+  };
+
+  template <typename TInput>
+  ETL_CONSTANT size_t p2_quantile<TInput>::Number_Of_Markers;
+} // namespace etl
+
+#endif
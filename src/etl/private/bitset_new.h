@@ -610,26 +610,17 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
+        // Always search for a set bit, ignoring those before the start position.
+        element_type value = state ? *pbuffer : element_type(~*pbuffer);
+        value              = element_type(value & element_type(All_Set_Element << position));
 
-        element_type mask = 1U << position;
-
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          const size_t bit = etl::count_trailing_zeros(value);
+
+          if (bit < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -637,6 +628,31 @@ namespace etl
       return npos;
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    //*************************************************************************
+    template <typename TFunction>
+    static ETL_CONSTEXPR14 void for_each_set_bit(const_pointer pbuffer, size_t /*number_of_elements*/, size_t active_bits, TFunction& function)
+    {
+      element_type value = *pbuffer;
+
+      while (value != All_Clear_Element)
+      {
+        const size_t bit = etl::count_trailing_zeros(value);
+
+        if (bit >= active_bits)
+        {
+          return;
+        }
+
+        function(bit);
+
+        // Clear the lowest set bit.
+        value = element_type(value & (value - 1U));
+      }
+    }
+
     //*************************************************************************
     /// operator assignment
     /// Assigns rhs to lhs
@@ -793,6 +809,22 @@ namespace etl
     {
       size_t count = 0;
 
+#if ETL_USING_64BIT_TYPES
+      // Gather narrow elements into 64 bit lanes, so that there is one
+      // population count per lane.
+      const size_t Elements_Per_Lane = 64U / Bits_Per_Element;
+
+      if (Elements_Per_Lane > 1U)
+      {
+        while (number_of_elements >= Elements_Per_Lane)
+        {
+          count += etl::count_bits(gather_lane(pbuffer));
+          pbuffer += Elements_Per_Lane;
+          number_of_elements -= Elements_Per_Lane;
+        }
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         count += etl::count_bits(*pbuffer++);
@@ -1280,41 +1312,26 @@ namespace etl
     {
       // Where to start.
       size_t index = position >> log2<Bits_Per_Element>::value;
-      size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      // Ignore the bits before the start position in the first element.
+      element_type mask = element_type(All_Set_Element << (position & (Bits_Per_Element - 1)));
 
       // For each element in the bitset...
       while (index < number_of_elements)
       {
-        element_type value = pbuffer[index];
+        // Always search for a set bit.
+        element_type value = state ? pbuffer[index] : element_type(~pbuffer[index]);
+        value              = element_type(value & mask);
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) || (!state && (value != All_Set_Element)))
-        {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
+        if (value != All_Clear_Element)
         {
-          position += (Bits_Per_Element - bit);
+          position = (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+          return (position < total_bits) ? position : npos;
         }
 
         // Start at the beginning for all other elements.
-        bit  = 0;
-        mask = 1;
+        mask = All_Set_Element;
 
         ++index;
       }
@@ -1322,6 +1339,34 @@ namespace etl
       return npos;
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order.
+    //*************************************************************************
+    template <typename TFunction>
+    static ETL_CONSTEXPR14 void for_each_set_bit(const_pointer pbuffer, size_t number_of_elements, size_t total_bits, TFunction& function)
+    {
+      for (size_t index = 0U; index < number_of_elements; ++index)
+      {
+        element_type value = pbuffer[index];
+
+        while (value != All_Clear_Element)
+        {
+          const size_t position = (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+          if (position >= total_bits)
+          {
+            return;
+          }
+
+          function(position);
+
+          // Clear the lowest set bit.
+          value = element_type(value & (value - 1U));
+        }
+      }
+    }
+
     //*************************************************************************
     /// Returns a string representing the bitset.
     //*************************************************************************
@@ -1592,6 +1637,42 @@ namespace etl
     {
       etl::swap_ranges(pbuffer1, pbuffer1 + number_of_elements, pbuffer2);
     }
+
+  private:
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Gathers the narrow elements that fill a 64 bit lane.
+    /// The shifts are unrolled, so that the compiler may merge them into a
+    /// single load.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint64_t gather_lane(const_pointer pbuffer) ETL_NOEXCEPT
+    {
+      if (Bits_Per_Element == 8U)
+      {
+        return (static_cast<uint64_t>(pbuffer[0]))        |
+               (static_cast<uint64_t>(pbuffer[1]) << 8U)  |
+               (static_cast<uint64_t>(pbuffer[2]) << 16U) |
+               (static_cast<uint64_t>(pbuffer[3]) << 24U) |
+               (static_cast<uint64_t>(pbuffer[4]) << 32U) |
+               (static_cast<uint64_t>(pbuffer[5]) << 40U) |
+               (static_cast<uint64_t>(pbuffer[6]) << 48U) |
+               (static_cast<uint64_t>(pbuffer[7]) << 56U);
+      }
+      else if (Bits_Per_Element == 16U)
+      {
+        return (static_cast<uint64_t>(pbuffer[0]))        |
+               (static_cast<uint64_t>(pbuffer[1]) << 16U) |
+               (static_cast<uint64_t>(pbuffer[2]) << 32U) |
+               (static_cast<uint64_t>(pbuffer[3]) << 48U);
+      }
+      else
+      {
+        return (static_cast<uint64_t>(pbuffer[0])) |
+               (static_cast<uint64_t>(pbuffer[1]) << 32U);
+      }
+    }
+#endif
   };
 
   namespace private_bitset
@@ -2316,6 +2397,20 @@ namespace etl
       return implementation::find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order. Whole elements are skipped when they have no bits set.
+    ///\param function The function to call, as <b>void(size_t)</b>.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      implementation::for_each_set_bit(buffer, Number_Of_Elements, Active_Bits, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -3313,6 +3408,20 @@ namespace etl
       return implementation::find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending
+    /// order. Whole elements are skipped when they have no bits set.
+    ///\param function The function to call, as <b>void(size_t)</b>.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      implementation::for_each_set_bit(pbuffer, Number_Of_Elements, Active_Bits, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -0,0 +1,177 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BOUNDED_MPMC_QUEUE_INCLUDED
+#define ETL_BOUNDED_MPMC_QUEUE_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "../power.h"
+#include "../static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_bounded_mpmc_queue
+  {
+    //*************************************************************************
+    /// A fixed capacity, multiple producer, multiple consumer queue, after
+    /// Dmitry Vyukov's bounded queue.
+    /// T must be suitable for etl::atomic.
+    /// A pop() claims a cell before it releases it, so while a thread is
+    /// preempted between the two, a push() that reaches that cell fails even
+    /// though the queue is not full. A caller that knows that there is room
+    /// must retry the push.
+    //*************************************************************************
+    template <typename T, size_t Capacity>
+    class bounded_mpmc_queue
+    {
+    public:
+
+      ETL_STATIC_ASSERT(etl::is_power_of_2<Capacity>::value, "Capacity must be a power of 2");
+
+      //***********************************
+      bounded_mpmc_queue()
+      {
+        enqueue_position.store(0U);
+        dequeue_position.store(0U);
+
+        for (size_t i = 0U; i < Capacity; ++i)
+        {
+          cells[i].sequence.store(uint32_t(i), etl::memory_order_relaxed);
+        }
+      }
+
+      //***********************************
+      /// Pushes an item.
+      ///\return <b>false</b> if the queue is full, or the next cell has not
+      /// yet been released by a pop().
+      //***********************************
+      bool push(T item)
+      {
+        uint32_t position = enqueue_position.load(etl::memory_order_relaxed);
+        cell*    p_cell;
+
+        while (true)
+        {
+          p_cell = &cells[position & Mask];
+
+          const int32_t difference = int32_t(p_cell->sequence.load(etl::memory_order_acquire) - position);
+
+          if (difference == 0)
+          {
+            if (enqueue_position.compare_exchange_weak(position, position + 1U, etl::memory_order_relaxed, etl::memory_order_relaxed))
+            {
+              break;
+            }
+          }
+          else if (difference < 0)
+          {
+            // Full.
+            return false;
+          }
+          else
+          {
+            position = enqueue_position.load(etl::memory_order_relaxed);
+          }
+        }
+
+        p_cell->item.store(item, etl::memory_order_relaxed);
+        p_cell->sequence.store(position + 1U, etl::memory_order_release);
+
+        return true;
+      }
+
+      //***********************************
+      /// Pops an item.
+      ///\return <b>false</b> if the queue is empty.
+      //***********************************
+      bool pop(T& item)
+      {
+        uint32_t position = dequeue_position.load(etl::memory_order_relaxed);
+        cell*    p_cell;
+
+        while (true)
+        {
+          p_cell = &cells[position & Mask];
+
+          const int32_t difference = int32_t(p_cell->sequence.load(etl::memory_order_acquire) - (position + 1U));
+
+          if (difference == 0)
+          {
+            if (dequeue_position.compare_exchange_weak(position, position + 1U, etl::memory_order_relaxed, etl::memory_order_relaxed))
+            {
+              break;
+            }
+          }
+          else if (difference < 0)
+          {
+            // Empty.
+            return false;
+          }
+          else
+          {
+            position = dequeue_position.load(etl::memory_order_relaxed);
+          }
+        }
+
+        item = p_cell->item.load(etl::memory_order_relaxed);
+        p_cell->sequence.store(position + uint32_t(Capacity), etl::memory_order_release);
+
+        return true;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Mask = uint32_t(Capacity - 1U);
+
+      struct cell
+      {
+        etl::atomic<uint32_t> sequence;
+        etl::atomic<T>        item;
+      };
+
+      etl::atomic<uint32_t> enqueue_position;
+      etl::atomic<uint32_t> dequeue_position;
+      cell                  cells[Capacity];
+    };
+
+    template <typename T, size_t Capacity>
+    ETL_CONSTANT uint32_t bounded_mpmc_queue<T, Capacity>::Mask;
+  } // namespace private_bounded_mpmc_queue
+} // namespace etl
+
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PAIRWISE_SUM_INCLUDED
+#define ETL_PAIRWISE_SUM_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //***************************************************************************
+    /// The term for a sum of values.
+    //***************************************************************************
+    template <typename TInput, typename TCalc>
+    struct value_term
+    {
+      explicit value_term(const TInput* p_values_)
+        : p_values(p_values_)
+      {
+      }
+
+      TCalc operator()(size_t i) const
+      {
+        return TCalc(p_values[i]);
+      }
+
+      const TInput* p_values;
+    };
+
+    //***************************************************************************
+    /// The term for a sum of squares.
+    //***************************************************************************
+    template <typename TInput, typename TCalc>
+    struct square_term
+    {
+      explicit square_term(const TInput* p_values_)
+        : p_values(p_values_)
+      {
+      }
+
+      TCalc operator()(size_t i) const
+      {
+        return TCalc(p_values[i] * p_values[i]);
+      }
+
+      const TInput* p_values;
+    };
+
+    //***************************************************************************
+    /// The term for an inner product.
+    //***************************************************************************
+    template <typename TInput, typename TCalc>
+    struct product_term
+    {
+      product_term(const TInput* p_values1_, const TInput* p_values2_)
+        : p_values1(p_values1_)
+        , p_values2(p_values2_)
+      {
+      }
+
+      TCalc operator()(size_t i) const
+      {
+        return TCalc(p_values1[i] * p_values2[i]);
+      }
+
+      const TInput* p_values1;
+      const TInput* p_values2;
+    };
+
+    //***************************************************************************
+    /// Sums term(first) to term(first + length - 1) by pairwise summation.
+    /// The rounding error grows with log(length), rather than with length as
+    /// for a running sum.
+    /// Short runs are summed in eight independent lanes, which compilers can
+    /// keep in vector registers.
+    /// The add(span) members of the statistics classes use this, as it is
+    /// faster and more accurate than adding the values one at a time.
+    //***************************************************************************
+    template <typename TCalc, typename TTerm>
+    TCalc pairwise_sum(const TTerm& term, size_t first, size_t length)
+    {
+      const size_t Lanes      = 8U;
+      const size_t Block_Size = 128U;
+
+      if (length > Block_Size)
+      {
+        // Split on a multiple of the block size.
+        const size_t half = ((length / 2U) + Block_Size - 1U) & ~(Block_Size - 1U);
+
+        return pairwise_sum<TCalc>(term, first, half) + pairwise_sum<TCalc>(term, first + half, length - half);
+      }
+
+      TCalc lane[Lanes];
+
+      for (size_t j = 0U; j < Lanes; ++j)
+      {
+        lane[j] = TCalc(0);
+      }
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= length; i += Lanes)
+      {
+        for (size_t j = 0U; j < Lanes; ++j)
+        {
+          lane[j] += term(first + i + j);
+        }
+      }
+
+      TCalc total = ((lane[0] + lane[1]) + (lane[2] + lane[3])) + ((lane[4] + lane[5]) + (lane[6] + lane[7]));
+
+      for (; i < length; ++i)
+      {
+        total += term(first + i);
+      }
+
+      return total;
+    }
+  } // namespace private_statistics
+} // namespace etl
+
+#endif
@@ -0,0 +1,508 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_SEARCH_INCLUDED
+#define ETL_SOA_FLAT_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../placement_new.h"
+#include "../utility.h"
+#include "prefetch.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for the structure-of-arrays flat containers.
+  //***************************************************************************
+  class soa_flat_exception : public etl::exception
+  {
+  public:
+
+    soa_flat_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Container full exception.
+  //***************************************************************************
+  class soa_flat_full : public etl::soa_flat_exception
+  {
+  public:
+
+    soa_flat_full(string_type file_name_, numeric_type line_number_)
+      : soa_flat_exception(ETL_ERROR_TEXT("soa_flat:full", ETL_SOA_FLAT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception.
+  //***************************************************************************
+  class soa_flat_out_of_bounds : public etl::soa_flat_exception
+  {
+  public:
+
+    soa_flat_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : soa_flat_exception(ETL_ERROR_TEXT("soa_flat:bounds", ETL_SOA_FLAT_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Sorted range is not sorted, or contains duplicate keys.
+  //***************************************************************************
+  class soa_flat_unsorted : public etl::soa_flat_exception
+  {
+  public:
+
+    soa_flat_unsorted(string_type file_name_, numeric_type line_number_)
+      : soa_flat_exception(ETL_ERROR_TEXT("soa_flat:unsorted", ETL_SOA_FLAT_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_flat
+  {
+    //*************************************************************************
+    /// Casts to an rvalue reference, where supported.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    template <typename T>
+    T&& move_value(T& value)
+    {
+      return etl::move(value);
+    }
+#else
+    template <typename T>
+    const T& move_value(T& value)
+    {
+      return value;
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a value at 'position' in an array of 'size' constructed
+    /// elements, shifting the following elements up by one.
+    //*************************************************************************
+    template <typename T>
+    void insert_value(T* p, size_t size, size_t position, const T& value)
+    {
+      if (position == size)
+      {
+        ::new (p + size) T(value);
+      }
+      else
+      {
+        ::new (p + size) T(move_value(p[size - 1U]));
+
+        for (size_t i = size - 1U; i > position; --i)
+        {
+          p[i] = move_value(p[i - 1U]);
+        }
+
+        p[position] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the value at 'position' in an array of 'size' constructed
+    /// elements, shifting the following elements down by one.
+    //*************************************************************************
+    template <typename T>
+    void erase_value(T* p, size_t size, size_t position)
+    {
+      for (size_t i = position + 1U; i < size; ++i)
+      {
+        p[i - 1U] = move_value(p[i]);
+      }
+
+      p[size - 1U].~T();
+    }
+
+    //*************************************************************************
+    /// Writes a value during a backward merge.
+    /// Slots below 'constructed' hold live elements and are assigned; slots
+    /// above are raw storage and are constructed.
+    //*************************************************************************
+    template <typename T, typename TValue>
+    void place_value(T* p, size_t constructed, size_t position, const TValue& value)
+    {
+      if (position < constructed)
+      {
+        p[position] = value;
+      }
+      else
+      {
+        ::new (p + position) T(value);
+      }
+    }
+
+#if ETL_USING_CPP11
+    template <typename T>
+    void place_value(T* p, size_t constructed, size_t position, T&& value)
+    {
+      if (position < constructed)
+      {
+        p[position] = etl::move(value);
+      }
+      else
+      {
+        ::new (p + position) T(etl::move(value));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// The sorted key array and search layouts shared by the
+    /// structure-of-arrays flat containers.
+    /// Keys are held contiguously and in order, so a search never touches
+    /// the mapped values.
+    /// Optionally, a copy of the keys is also held in Eytzinger (breadth
+    /// first) order. The first levels of the implicit tree share cache lines
+    /// and the descendants of a node four levels down are adjacent, so they
+    /// can be prefetched while the current level is compared. The copy is
+    /// rebuilt in O(N) after every modification, so the layout suits tables
+    /// that are read far more often than they are written.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare>
+    class soa_key_search
+    {
+    public:
+
+      typedef TKey        key_type;
+      typedef TKeyCompare key_compare;
+      typedef size_t      size_type;
+
+      //*********************************************************************
+      /// Returns the number of elements.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Checks if the container is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks if the container is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Returns the maximum number of elements.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Returns the capacity.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return CAPACITY;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_type available() const
+      {
+        return CAPACITY - current_size;
+      }
+
+      //*********************************************************************
+      /// Returns the key comparison function.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+      //*********************************************************************
+      /// Returns <b>true</b> if searches use the Eytzinger layout.
+      //*********************************************************************
+      bool has_eytzinger_layout() const
+      {
+        return p_layout_keys != ETL_NULLPTR;
+      }
+
+      //*********************************************************************
+      /// Returns a pointer to the contiguous, sorted keys.
+      //*********************************************************************
+      const key_type* keys() const
+      {
+        return p_keys;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      /// p_layout_keys_ and p_layout_index_ must hold max_size_ + 1 elements,
+      /// or both be null if the Eytzinger layout is not used.
+      //*********************************************************************
+      soa_key_search(TKey* p_keys_, TKey* p_layout_keys_, size_t* p_layout_index_, size_type max_size_)
+        : p_keys(p_keys_)
+        , p_layout_keys(p_layout_keys_)
+        , p_layout_index(p_layout_index_)
+        , current_size(0U)
+        , layout_size(0U)
+        , CAPACITY(max_size_)
+        , compare()
+      {
+      }
+
+      //*********************************************************************
+      /// Returns the index of the first key not less than 'key'.
+      //*********************************************************************
+      size_type lower_bound_index(const key_type& key) const
+      {
+        return has_eytzinger_layout() ? eytzinger_lower_bound(key) : sorted_lower_bound(key);
+      }
+
+      //*********************************************************************
+      /// Returns the index of 'key', or size() if not found.
+      //*********************************************************************
+      size_type find_index(const key_type& key) const
+      {
+        if (has_eytzinger_layout())
+        {
+          // Compare against the layout copy, which is already in cache.
+          const size_type k = eytzinger_search(key);
+
+          return ((k != 0U) && !compare(key, p_layout_keys[k])) ? p_layout_index[k] : current_size;
+        }
+
+        const size_type i = sorted_lower_bound(key);
+
+        return ((i != current_size) && !compare(key, p_keys[i])) ? i : current_size;
+      }
+
+      //*********************************************************************
+      /// Returns <b>true</b> if the key at 'i' is equal to 'key'.
+      //*********************************************************************
+      bool key_at_is(size_type i, const key_type& key) const
+      {
+        return (i != current_size) && !compare(key, p_keys[i]);
+      }
+
+      //*********************************************************************
+      /// Counts the keys in the strictly increasing range that are not
+      /// already in the container.
+      /// Returns false if the range is not strictly increasing.
+      //*********************************************************************
+      template <typename TIterator, typename TGetKey>
+      bool count_new_keys(TIterator first, TIterator last, TGetKey get_key, size_type& count) const
+      {
+        count = 0U;
+
+        size_type i = 0U;
+        TIterator previous = first;
+
+        while (first != last)
+        {
+          const key_type& key = get_key(first);
+
+          if ((previous != first) && !compare(get_key(previous), key))
+          {
+            return false;
+          }
+
+          while ((i != current_size) && compare(p_keys[i], key))
+          {
+            ++i;
+          }
+
+          if (!key_at_is(i, key))
+          {
+            ++count;
+          }
+
+          previous = first;
+          ++first;
+        }
+
+        return true;
+      }
+
+      //*********************************************************************
+      /// Destroys all of the keys.
+      //*********************************************************************
+      void clear_keys()
+      {
+        for (size_type i = 0U; i < current_size; ++i)
+        {
+          p_keys[i].~TKey();
+        }
+
+        current_size = 0U;
+        rebuild_layout();
+      }
+
+      //*********************************************************************
+      /// Rebuilds the Eytzinger layout from the sorted keys.
+      //*********************************************************************
+      void rebuild_layout()
+      {
+        if (!has_eytzinger_layout())
+        {
+          return;
+        }
+
+        for (size_type k = 1U; k <= layout_size; ++k)
+        {
+          p_layout_keys[k].~TKey();
+        }
+
+        size_type i = 0U;
+        build_layout(1U, i);
+        layout_size = current_size;
+      }
+
+      TKey*             p_keys;
+      TKey*             p_layout_keys;  ///< 1 based. Element 0 is unused.
+      size_t*           p_layout_index; ///< The sorted index of each Eytzinger key.
+      size_type         current_size;
+      size_type         layout_size;
+      const size_type   CAPACITY;
+      key_compare       compare;
+
+    private:
+
+      /// The distance, in nodes, to the descendants four levels down.
+      static ETL_CONSTANT size_type Prefetch_Stride = 16U;
+
+      //*********************************************************************
+      /// Branchless binary search of the sorted keys.
+      /// The loop has a fixed trip count for a given size, and the
+      /// comparison selects the next base rather than a branch.
+      //*********************************************************************
+      size_type sorted_lower_bound(const key_type& key) const
+      {
+        if (current_size == 0U)
+        {
+          return 0U;
+        }
+
+        const TKey* base   = p_keys;
+        size_type   length = current_size;
+
+        while (length > 1U)
+        {
+          const size_type half = length / 2U;
+
+          base = compare(base[half], key) ? base + half : base;
+          length -= half;
+        }
+
+        return static_cast<size_type>(base - p_keys) + (compare(*base, key) ? 1U : 0U);
+      }
+
+      //*********************************************************************
+      /// Returns the sorted index of the first key not less than 'key', using
+      /// the Eytzinger layout.
+      //*********************************************************************
+      size_type eytzinger_lower_bound(const key_type& key) const
+      {
+        const size_type k = eytzinger_search(key);
+
+        return (k == 0U) ? current_size : p_layout_index[k];
+      }
+
+      //*********************************************************************
+      /// Branchless search of the Eytzinger layout.
+      /// The path taken is recorded in the bits of k. The lower bound is the
+      /// last node at which the search went left, found by discarding the
+      /// trailing right turns.
+      /// Returns the layout position of the lower bound, or 0 if there is none.
+      //*********************************************************************
+      size_type eytzinger_search(const key_type& key) const
+      {
+        size_type k = 1U;
+
+        while (k <= current_size)
+        {
+          const size_type ahead = k * Prefetch_Stride;
+
+          if (ahead <= current_size)
+          {
+            etl::private_prefetch::prefetch(p_layout_keys + ahead);
+          }
+
+          k = (2U * k) + (compare(p_layout_keys[k], key) ? 1U : 0U);
+        }
+
+        return k >> (etl::count_trailing_ones(k) + 1U);
+      }
+
+      //*********************************************************************
+      /// Fills the Eytzinger layout by an in-order walk of the implicit tree.
+      //*********************************************************************
+      void build_layout(size_type k, size_type& i)
+      {
+        if (k <= current_size)
+        {
+          build_layout(2U * k, i);
+          ::new (p_layout_keys + k) TKey(p_keys[i]);
+          p_layout_index[k] = i;
+          ++i;
+          build_layout((2U * k) + 1U, i);
+        }
+      }
+
+      // Disable copy construction and assignment.
+      soa_key_search(const soa_key_search&);
+      soa_key_search& operator=(const soa_key_search&);
+    };
+
+    template <typename TKey, typename TKeyCompare>
+    ETL_CONSTANT typename soa_key_search<TKey, TKeyCompare>::size_type soa_key_search<TKey, TKeyCompare>::Prefetch_Stride;
+  } // namespace private_soa_flat
+} // namespace etl
+
+#endif
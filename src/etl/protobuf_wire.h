@@ -0,0 +1,706 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PROTOBUF_WIRE_INCLUDED
+#define ETL_PROTOBUF_WIRE_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP11 && ETL_USING_64BIT_TYPES
+
+#include "byte_stream.h"
+#include "endianness.h"
+#include "enum_type.h"
+#include "optional.h"
+#include "span.h"
+#include "string_view.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup protobuf_wire protobuf_wire
+/// Encodes and decodes the protocol buffers wire format in a caller supplied
+/// buffer, without allocation.
+/// This is the wire format only; there is no schema or code generation.
+/// Groups (wire types 3 and 4) are not supported.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The protocol buffers wire types.
+  ///\ingroup protobuf_wire
+  //***************************************************************************
+  struct protobuf_wire_type
+  {
+    enum enum_type
+    {
+      varint = 0, ///< int32, int64, uint32, uint64, sint32, sint64, bool, enum.
+      i64    = 1, ///< fixed64, sfixed64, double.
+      len    = 2, ///< string, bytes, embedded messages, packed repeated fields.
+      sgroup = 3, ///< Group start. Not supported.
+      egroup = 4, ///< Group end. Not supported.
+      i32    = 5  ///< fixed32, sfixed32, float.
+    };
+
+    ETL_DECLARE_ENUM_TYPE(protobuf_wire_type, uint8_t)
+    ETL_ENUM_TYPE(varint, "varint")
+    ETL_ENUM_TYPE(i64,    "i64")
+    ETL_ENUM_TYPE(len,    "len")
+    ETL_ENUM_TYPE(sgroup, "sgroup")
+    ETL_ENUM_TYPE(egroup, "egroup")
+    ETL_ENUM_TYPE(i32,    "i32")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// Writes protocol buffers wire format fields to a buffer.
+  /// Each write either writes the whole field or, if there is not enough space,
+  /// writes nothing and returns <b>false</b>.
+  ///\ingroup protobuf_wire
+  //***************************************************************************
+  class protobuf_writer
+  {
+  public:
+
+    typedef size_t position_type;
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    explicit protobuf_writer(etl::span<uint8_t> buffer)
+      : stream(buffer, etl::endian::little)
+    {
+    }
+
+    //***************************************************************************
+    /// Write a uint64 field.
+    //***************************************************************************
+    bool write_uint64(uint32_t field, uint64_t value)
+    {
+      return write_varint_field(field, value);
+    }
+
+    //***************************************************************************
+    /// Write a uint32 field.
+    //***************************************************************************
+    bool write_uint32(uint32_t field, uint32_t value)
+    {
+      return write_varint_field(field, value);
+    }
+
+    //***************************************************************************
+    /// Write an int64 field.
+    //***************************************************************************
+    bool write_int64(uint32_t field, int64_t value)
+    {
+      return write_varint_field(field, static_cast<uint64_t>(value));
+    }
+
+    //***************************************************************************
+    /// Write an int32 or enum field.
+    /// Negative values are sign extended to 64 bits, as the format requires.
+    //***************************************************************************
+    bool write_int32(uint32_t field, int32_t value)
+    {
+      return write_varint_field(field, static_cast<uint64_t>(static_cast<int64_t>(value)));
+    }
+
+    //***************************************************************************
+    /// Write a zigzag encoded sint64 field.
+    //***************************************************************************
+    bool write_sint64(uint32_t field, int64_t value)
+    {
+      return write_varint_field(field, etl::zigzag_encode(value));
+    }
+
+    //***************************************************************************
+    /// Write a zigzag encoded sint32 field.
+    //***************************************************************************
+    bool write_sint32(uint32_t field, int32_t value)
+    {
+      return write_varint_field(field, etl::zigzag_encode(value));
+    }
+
+    //***************************************************************************
+    /// Write a bool field.
+    //***************************************************************************
+    bool write_bool(uint32_t field, bool value)
+    {
+      return write_varint_field(field, value ? 1U : 0U);
+    }
+
+    //***************************************************************************
+    /// Write a fixed32 field.
+    //***************************************************************************
+    bool write_fixed32(uint32_t field, uint32_t value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i32, value);
+    }
+
+    //***************************************************************************
+    /// Write an sfixed32 field.
+    //***************************************************************************
+    bool write_sfixed32(uint32_t field, int32_t value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i32, value);
+    }
+
+    //***************************************************************************
+    /// Write a float field.
+    //***************************************************************************
+    bool write_float(uint32_t field, float value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i32, value);
+    }
+
+    //***************************************************************************
+    /// Write a fixed64 field.
+    //***************************************************************************
+    bool write_fixed64(uint32_t field, uint64_t value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i64, value);
+    }
+
+    //***************************************************************************
+    /// Write an sfixed64 field.
+    //***************************************************************************
+    bool write_sfixed64(uint32_t field, int64_t value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i64, value);
+    }
+
+    //***************************************************************************
+    /// Write a double field.
+    //***************************************************************************
+    bool write_double(uint32_t field, double value)
+    {
+      return write_fixed_field(field, etl::protobuf_wire_type::i64, value);
+    }
+
+    //***************************************************************************
+    /// Write a bytes field.
+    //***************************************************************************
+    bool write_bytes(uint32_t field, etl::span<const uint8_t> value)
+    {
+      return write_len_field(field, reinterpret_cast<const char*>(value.data()), value.size());
+    }
+
+    //***************************************************************************
+    /// Write a string field.
+    //***************************************************************************
+    bool write_string(uint32_t field, etl::string_view value)
+    {
+      return write_len_field(field, value.data(), value.size());
+    }
+
+    //***************************************************************************
+    /// Starts an embedded message, or a packed repeated field.
+    /// One byte is reserved for the length, which is written by end_message().
+    /// 'position' receives the value to pass to end_message().
+    //***************************************************************************
+    bool begin_message(uint32_t field, position_type& position)
+    {
+      const uint64_t tag = make_tag(field, etl::protobuf_wire_type::len);
+
+      bool success = (stream.available_bytes() >= (etl::varint_size(tag) + 1U));
+
+      if (success)
+      {
+        stream.write_varint_unchecked(tag);
+        position = stream.size_bytes();
+        stream.write_unchecked(static_cast<uint8_t>(0U));
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Ends an embedded message started with begin_message().
+    /// If the length needs more than the one reserved byte, the contents are
+    /// moved up to make room. Returns <b>false</b> if there is not the space
+    /// to do so, leaving the message unterminated.
+    //***************************************************************************
+    bool end_message(position_type position)
+    {
+      const size_t start  = position + 1U;
+      const size_t length = stream.size_bytes() - start;
+      const size_t extra  = etl::varint_size(length) - 1U;
+
+      bool success = (stream.available_bytes() >= extra);
+
+      if (success)
+      {
+        char* const p = stream.data().data();
+
+        if (extra != 0U)
+        {
+          memmove(p + start + extra, p + start, length);
+          stream.skip<char>(extra);
+        }
+
+        etl::byte_stream_writer length_writer(p + position, extra + 1U, etl::endian::little);
+        length_writer.write_varint_unchecked(length);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Returns a span of the encoded data.
+    //***************************************************************************
+    etl::span<const uint8_t> used_data() const
+    {
+      etl::span<const char> used = stream.used_data();
+
+      return etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(used.data()), used.size());
+    }
+
+    //***************************************************************************
+    /// Returns the number of bytes encoded.
+    //***************************************************************************
+    size_t size_bytes() const
+    {
+      return stream.size_bytes();
+    }
+
+    //***************************************************************************
+    /// Sets the writer back to the start of the buffer.
+    //***************************************************************************
+    void restart()
+    {
+      stream.restart();
+    }
+
+  private:
+
+    //*********************************
+    static uint64_t make_tag(uint32_t field, etl::protobuf_wire_type type)
+    {
+      return (static_cast<uint64_t>(field) << 3U) | static_cast<uint64_t>(type.get_value());
+    }
+
+    //*********************************
+    template <typename T>
+    bool write_varint_field(uint32_t field, T value)
+    {
+      const uint64_t tag = make_tag(field, etl::protobuf_wire_type::varint);
+
+      bool success = (stream.available_bytes() >= (etl::varint_size(tag) + etl::varint_size(value)));
+
+      if (success)
+      {
+        stream.write_varint_unchecked(tag);
+        stream.write_varint_unchecked(value);
+      }
+
+      return success;
+    }
+
+    //*********************************
+    template <typename T>
+    bool write_fixed_field(uint32_t field, etl::protobuf_wire_type type, T value)
+    {
+      const uint64_t tag = make_tag(field, type);
+
+      bool success = (stream.available_bytes() >= (etl::varint_size(tag) + sizeof(T)));
+
+      if (success)
+      {
+        stream.write_varint_unchecked(tag);
+        stream.write_unchecked(value);
+      }
+
+      return success;
+    }
+
+    //*********************************
+    bool write_len_field(uint32_t field, const char* data, size_t length)
+    {
+      const uint64_t tag = make_tag(field, etl::protobuf_wire_type::len);
+
+      bool success = (stream.available_bytes() >= (etl::varint_size(tag) + etl::varint_size(length) + length));
+
+      if (success)
+      {
+        stream.write_varint_unchecked(tag);
+        stream.write_varint_unchecked(length);
+        stream.write_unchecked(data, length);
+      }
+
+      return success;
+    }
+
+    etl::byte_stream_writer stream; ///< The stream over the encoding buffer.
+  };
+
+  //***************************************************************************
+  /// Reads protocol buffers wire format fields from a buffer.
+  ///\code
+  /// etl::protobuf_reader reader(data);
+  ///
+  /// while (reader.next())
+  /// {
+  ///   switch (reader.field_number())
+  ///   {
+  ///     case 1:  id   = reader.read_uint32().value_or(0); break;
+  ///     case 2:  name = reader.read_string().value_or(""); break;
+  ///     default: reader.skip(); break;
+  ///   }
+  /// }
+  ///
+  /// bool ok = !reader.has_error();
+  ///\endcode
+  /// Reading a value with the wrong wire type, or malformed data, sets the
+  /// error flag and ends the iteration.
+  ///\ingroup protobuf_wire
+  //***************************************************************************
+  class protobuf_reader
+  {
+  public:
+
+    //***************************************************************************
+    /// Construct from span.
+    //***************************************************************************
+    explicit protobuf_reader(etl::span<const uint8_t> buffer)
+      : stream(buffer.data(), buffer.size(), etl::endian::little)
+      , number(0U)
+      , type(etl::protobuf_wire_type::varint)
+      , error(false)
+    {
+    }
+
+    //***************************************************************************
+    /// Reads the next field's tag.
+    /// Returns <b>false</b> at the end of the buffer or on an error.
+    //***************************************************************************
+    bool next()
+    {
+      if (error || (stream.available_bytes() == 0U))
+      {
+        return false;
+      }
+
+      etl::optional<uint32_t> tag = stream.read_varint<uint32_t>();
+
+      if (tag.has_value())
+      {
+        number = tag.value() >> 3U;
+        type   = etl::protobuf_wire_type(static_cast<uint8_t>(tag.value() & 0x07U));
+      }
+
+      error = !tag.has_value() || (number == 0U) || (type == etl::protobuf_wire_type::sgroup) || (type == etl::protobuf_wire_type::egroup)
+              || (type.get_value() > etl::protobuf_wire_type::i32);
+
+      return !error;
+    }
+
+    //***************************************************************************
+    /// The current field number.
+    //***************************************************************************
+    uint32_t field_number() const
+    {
+      return number;
+    }
+
+    //***************************************************************************
+    /// The current field's wire type.
+    //***************************************************************************
+    etl::protobuf_wire_type wire_type() const
+    {
+      return type;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if malformed data, or a mismatched wire type, was found.
+    //***************************************************************************
+    bool has_error() const
+    {
+      return error;
+    }
+
+    //***************************************************************************
+    /// Read a uint64 value.
+    //***************************************************************************
+    etl::optional<uint64_t> read_uint64()
+    {
+      return read_varint_value();
+    }
+
+    //***************************************************************************
+    /// Read a uint32 value. Larger values are truncated, as the format requires.
+    //***************************************************************************
+    etl::optional<uint32_t> read_uint32()
+    {
+      return convert<uint32_t>(read_varint_value());
+    }
+
+    //***************************************************************************
+    /// Read an int64 value.
+    //***************************************************************************
+    etl::optional<int64_t> read_int64()
+    {
+      return convert<int64_t>(read_varint_value());
+    }
+
+    //***************************************************************************
+    /// Read an int32 or enum value.
+    //***************************************************************************
+    etl::optional<int32_t> read_int32()
+    {
+      return convert<int32_t>(read_varint_value());
+    }
+
+    //***************************************************************************
+    /// Read a zigzag encoded sint64 value.
+    //***************************************************************************
+    etl::optional<int64_t> read_sint64()
+    {
+      etl::optional<uint64_t> value = read_varint_value();
+
+      return value.has_value() ? etl::optional<int64_t>(etl::zigzag_decode(value.value())) : etl::optional<int64_t>();
+    }
+
+    //***************************************************************************
+    /// Read a zigzag encoded sint32 value.
+    //***************************************************************************
+    etl::optional<int32_t> read_sint32()
+    {
+      etl::optional<uint64_t> value = read_varint_value();
+
+      return value.has_value() ? etl::optional<int32_t>(etl::zigzag_decode(static_cast<uint32_t>(value.value()))) : etl::optional<int32_t>();
+    }
+
+    //***************************************************************************
+    /// Read a bool value.
+    //***************************************************************************
+    etl::optional<bool> read_bool()
+    {
+      etl::optional<uint64_t> value = read_varint_value();
+
+      return value.has_value() ? etl::optional<bool>(value.value() != 0U) : etl::optional<bool>();
+    }
+
+    //***************************************************************************
+    /// Read a fixed32 value.
+    //***************************************************************************
+    etl::optional<uint32_t> read_fixed32()
+    {
+      return read_fixed_value<uint32_t>(etl::protobuf_wire_type::i32);
+    }
+
+    //***************************************************************************
+    /// Read an sfixed32 value.
+    //***************************************************************************
+    etl::optional<int32_t> read_sfixed32()
+    {
+      return read_fixed_value<int32_t>(etl::protobuf_wire_type::i32);
+    }
+
+    //***************************************************************************
+    /// Read a float value.
+    //***************************************************************************
+    etl::optional<float> read_float()
+    {
+      return read_fixed_value<float>(etl::protobuf_wire_type::i32);
+    }
+
+    //***************************************************************************
+    /// Read a fixed64 value.
+    //***************************************************************************
+    etl::optional<uint64_t> read_fixed64()
+    {
+      return read_fixed_value<uint64_t>(etl::protobuf_wire_type::i64);
+    }
+
+    //***************************************************************************
+    /// Read an sfixed64 value.
+    //***************************************************************************
+    etl::optional<int64_t> read_sfixed64()
+    {
+      return read_fixed_value<int64_t>(etl::protobuf_wire_type::i64);
+    }
+
+    //***************************************************************************
+    /// Read a double value.
+    //***************************************************************************
+    etl::optional<double> read_double()
+    {
+      return read_fixed_value<double>(etl::protobuf_wire_type::i64);
+    }
+
+    //***************************************************************************
+    /// Read a bytes value.
+    /// The span refers to the reader's buffer.
+    //***************************************************************************
+    etl::optional<etl::span<const uint8_t> > read_bytes()
+    {
+      etl::optional<etl::span<const uint8_t> > result;
+
+      if (check_type(etl::protobuf_wire_type::len))
+      {
+        result = stream.read_length_delimited<uint8_t>();
+        error  = !result.has_value();
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Read a string value.
+    /// The view refers to the reader's buffer.
+    //***************************************************************************
+    etl::optional<etl::string_view> read_string()
+    {
+      etl::optional<etl::span<const uint8_t> > bytes = read_bytes();
+
+      return bytes.has_value() ? etl::optional<etl::string_view>(etl::string_view(reinterpret_cast<const char*>(bytes.value().data()), bytes.value().size()))
+                               : etl::optional<etl::string_view>();
+    }
+
+    //***************************************************************************
+    /// Read an embedded message, or a packed repeated field.
+    /// Returns a reader over its contents.
+    //***************************************************************************
+    etl::optional<protobuf_reader> read_message()
+    {
+      etl::optional<etl::span<const uint8_t> > bytes = read_bytes();
+
+      return bytes.has_value() ? etl::optional<protobuf_reader>(protobuf_reader(bytes.value())) : etl::optional<protobuf_reader>();
+    }
+
+    //***************************************************************************
+    /// Skips the value of the current field.
+    //***************************************************************************
+    bool skip()
+    {
+      if (!error)
+      {
+        switch (type.get_enum())
+        {
+          case etl::protobuf_wire_type::varint:
+          {
+            error = !stream.read_varint<uint64_t>().has_value();
+            break;
+          }
+
+          case etl::protobuf_wire_type::i64:
+          {
+            error = !stream.skip<uint64_t>(1U);
+            break;
+          }
+
+          case etl::protobuf_wire_type::len:
+          {
+            error = !stream.read_length_delimited<uint8_t>().has_value();
+            break;
+          }
+
+          case etl::protobuf_wire_type::i32:
+          {
+            error = !stream.skip<uint32_t>(1U);
+            break;
+          }
+
+          default:
+          {
+            error = true;
+            break;
+          }
+        }
+      }
+
+      return !error;
+    }
+
+    //***************************************************************************
+    /// The number of bytes not yet read.
+    //***************************************************************************
+    size_t available_bytes() const
+    {
+      return stream.available_bytes();
+    }
+
+  private:
+
+    //*********************************
+    bool check_type(etl::protobuf_wire_type expected)
+    {
+      error = error || (type != expected);
+
+      return !error;
+    }
+
+    //*********************************
+    etl::optional<uint64_t> read_varint_value()
+    {
+      etl::optional<uint64_t> result;
+
+      if (check_type(etl::protobuf_wire_type::varint))
+      {
+        result = stream.read_varint<uint64_t>();
+        error  = !result.has_value();
+      }
+
+      return result;
+    }
+
+    //*********************************
+    template <typename T>
+    etl::optional<T> read_fixed_value(etl::protobuf_wire_type expected)
+    {
+      etl::optional<T> result;
+
+      if (check_type(expected))
+      {
+        result = stream.read<T>();
+        error  = !result.has_value();
+      }
+
+      return result;
+    }
+
+    //*********************************
+    template <typename T>
+    static etl::optional<T> convert(const etl::optional<uint64_t>& value)
+    {
+      return value.has_value() ? etl::optional<T>(static_cast<T>(value.value())) : etl::optional<T>();
+    }
+
+    etl::byte_stream_reader stream; ///< The stream over the encoded buffer.
+    uint32_t                number; ///< The current field number.
+    etl::protobuf_wire_type type;   ///< The current field's wire type.
+    bool                    error;  ///< Set on malformed data or a mismatched wire type.
+  };
+} // namespace etl
+
+#endif
+#endif
@@ -99,6 +99,20 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  ///\ingroup reference_flat_map
+  /// Vector iterator exception.
+  //***************************************************************************
+  class flat_map_iterator : public etl::flat_map_exception
+  {
+  public:
+
+    flat_map_iterator(string_type file_name_, numeric_type line_number_)
+      : flat_map_exception(ETL_ERROR_TEXT("flat_map:iterator", ETL_REFERENCE_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// The base class for specifically sized reference_flat_maps.
   /// Can be used as a reference type for all reference_flat_maps containing a
@@ -605,6 +619,23 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key, with a
+    /// single O(N + M) merge, rather than a search and a shift per element.
+    /// Keys already in the reference_flat_map are left unchanged.
+    /// The range must be bidirectional.
+    /// If asserts or exceptions are enabled, emits flat_map_iterator if the
+    /// range is not sorted, or flat_map_full if the new values will not fit.
+    /// In either case the reference_flat_map is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      merge_sorted(first, last, reference_value());
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -1051,6 +1082,102 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Returns a reference to an element of a range, for merge_sorted.
+    //*********************************************************************
+    struct reference_value
+    {
+      template <typename TIterator>
+      reference operator()(TIterator itr) const
+      {
+        return *itr;
+      }
+    };
+
+    //*********************************************************************
+    /// Merges a range, sorted by strictly increasing key, into the lookup with
+    /// a single backward pass, so that each existing element moves once.
+    /// 'make_value' returns a reference to the value to store for an element of
+    /// the range.
+    /// Keys already in the reference_flat_map are left unchanged.
+    /// Returns the number of values inserted. If the range is not sorted, or
+    /// will not fit, nothing is inserted.
+    //*********************************************************************
+    template <typename TIterator, typename TMakeValue>
+    size_t merge_sorted(TIterator first, TIterator last, const TMakeValue& make_value)
+    {
+      // Count the new keys, and check that the range is strictly increasing.
+      size_t n_new     = 0U;
+      bool   is_sorted = true;
+
+      typename lookup_t::const_iterator existing = lookup.begin();
+
+      for (TIterator itr = first, previous = first; is_sorted && (itr != last); previous = itr, ++itr)
+      {
+        is_sorted = (itr == first) || compare.comp(previous->first, itr->first);
+
+        while ((existing != lookup.end()) && compare.comp((*existing)->first, itr->first))
+        {
+          ++existing;
+        }
+
+        if ((existing == lookup.end()) || compare.comp(itr->first, (*existing)->first))
+        {
+          ++n_new;
+        }
+      }
+
+      if (!is_sorted || (n_new > lookup.available()))
+      {
+        ETL_ASSERT(is_sorted, ETL_ERROR(flat_map_iterator));
+        ETL_ASSERT(n_new <= lookup.available(), ETL_ERROR(flat_map_full));
+        return 0U;
+      }
+
+      if (n_new == 0U)
+      {
+        return 0U;
+      }
+
+      const size_t old_size = lookup.size();
+      size_t       r        = old_size;         // Existing elements below r are not yet placed.
+      size_t       w        = old_size + n_new; // Slots at and above w are filled.
+
+      lookup.resize(w, ETL_NULLPTR);
+
+      typename lookup_t::iterator p = lookup.begin();
+
+      TIterator itr = last;
+      --itr;
+
+      while (w != r)
+      {
+        if ((r != 0U) && compare.comp(itr->first, p[r - 1U]->first))
+        {
+          // The existing key is greater.
+          --w;
+          --r;
+          p[w] = p[r];
+        }
+        else
+        {
+          if ((r == 0U) || compare.comp(p[r - 1U]->first, itr->first))
+          {
+            // The new key is greater.
+            --w;
+            p[w] = &make_value(itr);
+          }
+
+          if (itr != first)
+          {
+            --itr;
+          }
+        }
+      }
+
+      return n_new;
+    }
+
   private:
 
     // Disable copy construction and assignment.
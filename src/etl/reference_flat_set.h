@@ -497,6 +497,23 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key, with a
+    /// single O(N + M) merge, rather than a search and a shift per element.
+    /// Keys already in the reference_flat_set are left unchanged.
+    /// The range must be bidirectional.
+    /// If asserts or exceptions are enabled, emits flat_set_iterator if the
+    /// range is not sorted, or flat_set_full if the new values will not fit.
+    /// In either case the reference_flat_set is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      merge_sorted(first, last, reference_value());
+    }
+
     //*********************************************************************
     /// Erases an element.
     ///\param key The key to erase.
@@ -918,6 +935,102 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Returns a reference to an element of a range, for merge_sorted.
+    //*********************************************************************
+    struct reference_value
+    {
+      template <typename TIterator>
+      reference operator()(TIterator itr) const
+      {
+        return *itr;
+      }
+    };
+
+    //*********************************************************************
+    /// Merges a range, sorted by strictly increasing key, into the lookup with
+    /// a single backward pass, so that each existing element moves once.
+    /// 'make_value' returns a reference to the value to store for an element of
+    /// the range.
+    /// Keys already in the reference_flat_set are left unchanged.
+    /// Returns the number of values inserted. If the range is not sorted, or
+    /// will not fit, nothing is inserted.
+    //*********************************************************************
+    template <typename TIterator, typename TMakeValue>
+    size_t merge_sorted(TIterator first, TIterator last, const TMakeValue& make_value)
+    {
+      // Count the new keys, and check that the range is strictly increasing.
+      size_t n_new     = 0U;
+      bool   is_sorted = true;
+
+      typename lookup_t::const_iterator existing = lookup.begin();
+
+      for (TIterator itr = first, previous = first; is_sorted && (itr != last); previous = itr, ++itr)
+      {
+        is_sorted = (itr == first) || compare(*previous, *itr);
+
+        while ((existing != lookup.end()) && compare(*(*existing), *itr))
+        {
+          ++existing;
+        }
+
+        if ((existing == lookup.end()) || compare(*itr, *(*existing)))
+        {
+          ++n_new;
+        }
+      }
+
+      if (!is_sorted || (n_new > lookup.available()))
+      {
+        ETL_ASSERT(is_sorted, ETL_ERROR(flat_set_iterator));
+        ETL_ASSERT(n_new <= lookup.available(), ETL_ERROR(flat_set_full));
+        return 0U;
+      }
+
+      if (n_new == 0U)
+      {
+        return 0U;
+      }
+
+      const size_t old_size = lookup.size();
+      size_t       r        = old_size;         // Existing elements below r are not yet placed.
+      size_t       w        = old_size + n_new; // Slots at and above w are filled.
+
+      lookup.resize(w, ETL_NULLPTR);
+
+      typename lookup_t::iterator p = lookup.begin();
+
+      TIterator itr = last;
+      --itr;
+
+      while (w != r)
+      {
+        if ((r != 0U) && compare(*itr, *p[r - 1U]))
+        {
+          // The existing key is greater.
+          --w;
+          --r;
+          p[w] = p[r];
+        }
+        else
+        {
+          if ((r == 0U) || compare(*p[r - 1U], *itr))
+          {
+            // The new key is greater.
+            --w;
+            p[w] = &make_value(itr);
+          }
+
+          if (itr != first)
+          {
+            --itr;
+          }
+        }
+      }
+
+      return n_new;
+    }
+
   private:
 
     // Disable copy construction.
@@ -0,0 +1,729 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SERIALIZE_INCLUDED
+#define ETL_SERIALIZE_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP17
+
+#include "array.h"
+#include "byte_stream.h"
+#include "endianness.h"
+#include "nullptr.h"
+#include "optional.h"
+#include "smallest.h"
+#include "span.h"
+#include "string.h"
+#include "type_traits.h"
+#include "vector.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup serialize serialize
+/// Declarative binary serialisation on top of etl::byte_stream_writer and
+/// etl::byte_stream_reader.
+/// A struct lists its fields once, as member pointers, and encode, decode and
+/// the maximum encoded size are generated from that list.
+///\code
+/// struct Message
+/// {
+///   uint16_t                 id;
+///   uint32_t                 timestamp;
+///   float                    values[3];
+///   etl::vector<uint8_t, 16> payload;
+///
+///   using serial_fields = etl::serial_fields<&Message::id, &Message::timestamp, &Message::values, &Message::payload>;
+/// };
+///
+/// char buffer[etl::serialized_size<Message>()];
+/// etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+/// etl::serialize(writer, message);
+///\endcode
+/// Types that cannot hold a nested list may specialise etl::serial_layout.
+///
+/// Arithmetic types and enums are written in the stream's byte order.
+/// etl::vector and etl::string are prefixed with their length, held in the
+/// smallest unsigned type that can hold their capacity.
+/// etl::optional is prefixed with a one byte presence flag.
+/// Arrays of arithmetic types have no prefix.
+///
+/// When the stream byte order matches the platform, runs of adjacent
+/// arithmetic fields and arithmetic arrays that are contiguous in memory are
+/// copied with a single block copy.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The list of serialised fields of a struct, as member pointers.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <auto... Members>
+  struct serial_fields
+  {
+  };
+
+  //***************************************************************************
+  /// Describes the serialised fields of T.
+  /// Defaults to T::serial_fields. Specialise to describe a type that cannot
+  /// be modified. The specialisation must define 'fields' as an
+  /// etl::serial_fields list.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T, typename = void>
+  struct serial_layout
+  {
+  };
+
+  template <typename T>
+  struct serial_layout<T, etl::void_t<typename T::serial_fields> >
+  {
+    using fields = typename T::serial_fields;
+  };
+
+  //***************************************************************************
+  /// Encodes and decodes one type.
+  /// Specialise to support custom types. A specialisation must provide:
+  ///  static constexpr size_t max_size;
+  ///  static constexpr bool   is_fixed; // The object representation is the encoding, for the platform byte order.
+  ///  static size_t size(const T&);
+  ///  static void   write(etl::byte_stream_writer&, const T&);
+  ///  static bool   read(etl::byte_stream_reader&, T&);
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T, typename = void>
+  struct serial_codec;
+
+  namespace private_serialize
+  {
+    //*************************************************************************
+    template <typename T, typename = void>
+    struct has_serial_layout : etl::false_type
+    {
+    };
+
+    template <typename T>
+    struct has_serial_layout<T, etl::void_t<typename etl::serial_layout<T>::fields> > : etl::true_type
+    {
+    };
+
+    //*************************************************************************
+    template <typename T>
+    struct member_pointer_traits;
+
+    template <typename TObject, typename TMember>
+    struct member_pointer_traits<TMember TObject::*>
+    {
+      using member_type = TMember;
+    };
+
+    template <auto Member>
+    using member_type_t = typename member_pointer_traits<decltype(Member)>::member_type;
+
+    //*************************************************************************
+    /// Arithmetic types and enums.
+    //*************************************************************************
+    template <typename T>
+    struct is_scalar : etl::bool_constant<etl::is_arithmetic<T>::value || etl::is_enum<T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Types that may be block copied.
+    /// bool is excluded as a decoded byte must be normalised.
+    //*************************************************************************
+    template <typename T>
+    struct is_block_element : etl::bool_constant<etl::is_arithmetic<T>::value && !etl::is_same<T, bool>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Writes n elements, block copying arithmetic element types.
+    //*************************************************************************
+    template <typename T>
+    void write_elements(etl::byte_stream_writer& stream, const T* p, size_t n)
+    {
+      if constexpr (is_block_element<T>::value)
+      {
+        stream.write_unchecked(p, n);
+      }
+      else
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          etl::serial_codec<T>::write(stream, p[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Reads n elements, block copying arithmetic element types.
+    //*************************************************************************
+    template <typename T>
+    bool read_elements(etl::byte_stream_reader& stream, T* p, size_t n)
+    {
+      if constexpr (is_block_element<T>::value)
+      {
+        return stream.read(p, n).has_value();
+      }
+      else
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (!etl::serial_codec<T>::read(stream, p[i]))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+    }
+
+    //*************************************************************************
+    /// The encoded size of n elements.
+    //*************************************************************************
+    template <typename T>
+    size_t elements_size(const T* p, size_t n)
+    {
+      if constexpr (is_scalar<T>::value)
+      {
+        (void)p;
+        return n * etl::serial_codec<T>::max_size;
+      }
+      else
+      {
+        size_t total = 0U;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          total += etl::serial_codec<T>::size(p[i]);
+        }
+
+        return total;
+      }
+    }
+
+    //*************************************************************************
+    /// A run of fields that are adjacent in memory, pending a block copy.
+    //*************************************************************************
+    template <typename TChar>
+    struct block_run
+    {
+      TChar* begin = ETL_NULLPTR;
+      TChar* end   = ETL_NULLPTR;
+    };
+
+    //*************************************************************************
+    /// Encodes and decodes a struct from its list of fields.
+    //*************************************************************************
+    template <typename T, typename TFields>
+    struct struct_codec;
+
+    template <typename T, auto... Members>
+    struct struct_codec<T, etl::serial_fields<Members...> >
+    {
+      static constexpr size_t max_size = (size_t(0U) + ... + etl::serial_codec<member_type_t<Members> >::max_size);
+
+      //*********************************
+      static size_t size(const T& value)
+      {
+        return (size_t(0U) + ... + etl::serial_codec<member_type_t<Members> >::size(value.*Members));
+      }
+
+      //*********************************
+      static void write(etl::byte_stream_writer& stream, const T& value)
+      {
+        if (stream.get_endianness() == etl::endianness::value())
+        {
+          write_fields<true>(stream, value);
+        }
+        else
+        {
+          write_fields<false>(stream, value);
+        }
+      }
+
+      //*********************************
+      static bool read(etl::byte_stream_reader& stream, T& value)
+      {
+        if (stream.get_endianness() == etl::endianness::value())
+        {
+          return read_fields<true>(stream, value);
+        }
+        else
+        {
+          return read_fields<false>(stream, value);
+        }
+      }
+
+    private:
+
+      //*********************************
+      /// Block copies runs of fixed fields if 'Block' is true.
+      /// Only valid when the stream byte order matches the platform.
+      //*********************************
+      template <bool Block>
+      static void write_fields(etl::byte_stream_writer& stream, const T& value)
+      {
+        if constexpr (Block)
+        {
+          block_run<const char> run;
+
+          (write_field<Members>(stream, value, run), ...);
+          flush(stream, run);
+        }
+        else
+        {
+          (etl::serial_codec<member_type_t<Members> >::write(stream, value.*Members), ...);
+        }
+      }
+
+      //*********************************
+      template <bool Block>
+      static bool read_fields(etl::byte_stream_reader& stream, T& value)
+      {
+        if constexpr (Block)
+        {
+          block_run<char> run;
+
+          return (read_field<Members>(stream, value, run) && ...) && flush(stream, run);
+        }
+        else
+        {
+          return (etl::serial_codec<member_type_t<Members> >::read(stream, value.*Members) && ...);
+        }
+      }
+
+      //*********************************
+      /// Adds a fixed field to the run, or flushes the run and writes the field.
+      //*********************************
+      template <auto Member>
+      static void write_field(etl::byte_stream_writer& stream, const T& value, block_run<const char>& run)
+      {
+        using member_t = member_type_t<Member>;
+
+        const member_t& member = value.*Member;
+
+        if constexpr (etl::serial_codec<member_t>::is_fixed)
+        {
+          const char* p = reinterpret_cast<const char*>(&member);
+
+          // Not adjacent to the current run?
+          if (p != run.end)
+          {
+            flush(stream, run);
+            run.begin = p;
+          }
+
+          run.end = p + sizeof(member_t);
+        }
+        else
+        {
+          flush(stream, run);
+          etl::serial_codec<member_t>::write(stream, member);
+        }
+      }
+
+      //*********************************
+      /// Adds a fixed field to the run, or flushes the run and reads the field.
+      //*********************************
+      template <auto Member>
+      static bool read_field(etl::byte_stream_reader& stream, T& value, block_run<char>& run)
+      {
+        using member_t = member_type_t<Member>;
+
+        member_t& member = value.*Member;
+
+        if constexpr (etl::serial_codec<member_t>::is_fixed)
+        {
+          char* p = reinterpret_cast<char*>(&member);
+
+          // Not adjacent to the current run?
+          if (p != run.end)
+          {
+            if (!flush(stream, run))
+            {
+              return false;
+            }
+
+            run.begin = p;
+          }
+
+          run.end = p + sizeof(member_t);
+          return true;
+        }
+        else
+        {
+          return flush(stream, run) && etl::serial_codec<member_t>::read(stream, member);
+        }
+      }
+
+      //*********************************
+      static void flush(etl::byte_stream_writer& stream, block_run<const char>& run)
+      {
+        if (run.begin != run.end)
+        {
+          stream.write_unchecked(run.begin, static_cast<size_t>(run.end - run.begin));
+          run.begin = run.end = ETL_NULLPTR;
+        }
+      }
+
+      //*********************************
+      static bool flush(etl::byte_stream_reader& stream, block_run<char>& run)
+      {
+        bool success = true;
+
+        if (run.begin != run.end)
+        {
+          success   = stream.read(run.begin, static_cast<size_t>(run.end - run.begin)).has_value();
+          run.begin = run.end = ETL_NULLPTR;
+        }
+
+        return success;
+      }
+    };
+  } // namespace private_serialize
+
+  //***************************************************************************
+  /// Arithmetic types and enums.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  struct serial_codec<T, etl::enable_if_t<private_serialize::is_scalar<T>::value> >
+  {
+    using value_t = typename etl::conditional_t<etl::is_enum<T>::value, etl::underlying_type<T>, etl::type_identity<T> >::type;
+
+    static constexpr size_t max_size = sizeof(value_t);
+    static constexpr bool   is_fixed = private_serialize::is_block_element<value_t>::value;
+
+    //*********************************
+    static size_t size(const T&)
+    {
+      return max_size;
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const T& value)
+    {
+      stream.write_unchecked(static_cast<value_t>(value));
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, T& value)
+    {
+      etl::optional<value_t> result = stream.read<value_t>();
+
+      if (result.has_value())
+      {
+        value = static_cast<T>(result.value());
+      }
+
+      return result.has_value();
+    }
+  };
+
+  //***************************************************************************
+  /// Arrays. No length prefix.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T, size_t Size>
+  struct serial_codec<T[Size]>
+  {
+    static constexpr size_t max_size = Size * etl::serial_codec<T>::max_size;
+    static constexpr bool   is_fixed = etl::serial_codec<T>::is_fixed && (sizeof(T) == etl::serial_codec<T>::max_size);
+
+    //*********************************
+    static size_t size(const T (&value)[Size])
+    {
+      return private_serialize::elements_size(value, Size);
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const T (&value)[Size])
+    {
+      private_serialize::write_elements(stream, value, Size);
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, T (&value)[Size])
+    {
+      return private_serialize::read_elements(stream, value, Size);
+    }
+  };
+
+  //***************************************************************************
+  /// etl::array. No length prefix.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T, size_t Size>
+  struct serial_codec<etl::array<T, Size> >
+  {
+    static constexpr size_t max_size = Size * etl::serial_codec<T>::max_size;
+    static constexpr bool   is_fixed = etl::serial_codec<T>::is_fixed && (sizeof(etl::array<T, Size>) == max_size);
+
+    //*********************************
+    static size_t size(const etl::array<T, Size>& value)
+    {
+      return private_serialize::elements_size(value.data(), Size);
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const etl::array<T, Size>& value)
+    {
+      private_serialize::write_elements(stream, value.data(), Size);
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, etl::array<T, Size>& value)
+    {
+      return private_serialize::read_elements(stream, value.data(), Size);
+    }
+  };
+
+  //***************************************************************************
+  /// etl::vector. Prefixed with the length.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T, size_t Max_Size>
+  struct serial_codec<etl::vector<T, Max_Size> >
+  {
+    using length_t = typename etl::smallest_uint_for_value<Max_Size>::type;
+
+    static constexpr size_t max_size = sizeof(length_t) + (Max_Size * etl::serial_codec<T>::max_size);
+    static constexpr bool   is_fixed = false;
+
+    //*********************************
+    static size_t size(const etl::vector<T, Max_Size>& value)
+    {
+      return sizeof(length_t) + private_serialize::elements_size(value.data(), value.size());
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const etl::vector<T, Max_Size>& value)
+    {
+      stream.write_unchecked(static_cast<length_t>(value.size()));
+      private_serialize::write_elements(stream, value.data(), value.size());
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, etl::vector<T, Max_Size>& value)
+    {
+      etl::optional<length_t> length = stream.read<length_t>();
+
+      if (!length.has_value() || (length.value() > Max_Size))
+      {
+        return false;
+      }
+
+      value.resize(length.value());
+
+      return private_serialize::read_elements(stream, value.data(), value.size());
+    }
+  };
+
+  //***************************************************************************
+  /// etl::string. Prefixed with the length.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <size_t Max_Size>
+  struct serial_codec<etl::string<Max_Size> >
+  {
+    using length_t = typename etl::smallest_uint_for_value<Max_Size>::type;
+
+    static constexpr size_t max_size = sizeof(length_t) + Max_Size;
+    static constexpr bool   is_fixed = false;
+
+    //*********************************
+    static size_t size(const etl::string<Max_Size>& value)
+    {
+      return sizeof(length_t) + value.size();
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const etl::string<Max_Size>& value)
+    {
+      stream.write_unchecked(static_cast<length_t>(value.size()));
+      stream.write_unchecked(value.data(), value.size());
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, etl::string<Max_Size>& value)
+    {
+      etl::optional<length_t> length = stream.read<length_t>();
+
+      if (!length.has_value() || (length.value() > Max_Size))
+      {
+        return false;
+      }
+
+      etl::optional<etl::span<const char> > text = stream.read<char>(length.value());
+
+      if (text.has_value())
+      {
+        value.assign(text.value().begin(), text.value().end());
+      }
+
+      return text.has_value();
+    }
+  };
+
+  //***************************************************************************
+  /// etl::optional. Prefixed with a presence flag.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  struct serial_codec<etl::optional<T> >
+  {
+    static constexpr size_t max_size = 1U + etl::serial_codec<T>::max_size;
+    static constexpr bool   is_fixed = false;
+
+    //*********************************
+    static size_t size(const etl::optional<T>& value)
+    {
+      return 1U + (value.has_value() ? etl::serial_codec<T>::size(value.value()) : 0U);
+    }
+
+    //*********************************
+    static void write(etl::byte_stream_writer& stream, const etl::optional<T>& value)
+    {
+      stream.write_unchecked(static_cast<uint8_t>(value.has_value() ? 1U : 0U));
+
+      if (value.has_value())
+      {
+        etl::serial_codec<T>::write(stream, value.value());
+      }
+    }
+
+    //*********************************
+    static bool read(etl::byte_stream_reader& stream, etl::optional<T>& value)
+    {
+      etl::optional<uint8_t> flag = stream.read<uint8_t>();
+
+      if (!flag.has_value() || (flag.value() > 1U))
+      {
+        return false;
+      }
+
+      if (flag.value() == 0U)
+      {
+        value.reset();
+        return true;
+      }
+
+      if (!value.has_value())
+      {
+        value.emplace();
+      }
+
+      return etl::serial_codec<T>::read(stream, value.value());
+    }
+  };
+
+  //***************************************************************************
+  /// Structs that describe their fields with etl::serial_layout.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  struct serial_codec<T, etl::enable_if_t<private_serialize::has_serial_layout<T>::value> >
+    : public private_serialize::struct_codec<T, typename etl::serial_layout<T>::fields>
+  {
+    static constexpr bool is_fixed = false;
+  };
+
+  //***************************************************************************
+  /// The maximum encoded size of T, for sizing buffers at compile time.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  constexpr size_t serialized_size()
+  {
+    return etl::serial_codec<T>::max_size;
+  }
+
+  //***************************************************************************
+  /// The encoded size of a value.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  size_t serialized_size(const T& value)
+  {
+    return etl::serial_codec<T>::size(value);
+  }
+
+  //***************************************************************************
+  /// Encodes a value to the stream without checking the space available.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  void serialize_unchecked(etl::byte_stream_writer& stream, const T& value)
+  {
+    etl::serial_codec<T>::write(stream, value);
+  }
+
+  //***************************************************************************
+  /// Encodes a value to the stream.
+  /// Returns <b>false</b>, having written nothing, if there is not enough space.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  bool serialize(etl::byte_stream_writer& stream, const T& value)
+  {
+    // Only measure the value if the maximum size might not fit.
+    const size_t n = ((etl::serial_codec<T>::max_size <= stream.available_bytes()) ? 0U : etl::serial_codec<T>::size(value));
+
+    bool success = (n <= stream.available_bytes());
+
+    if (success)
+    {
+      etl::serial_codec<T>::write(stream, value);
+    }
+
+    return success;
+  }
+
+  //***************************************************************************
+  /// Decodes a value from the stream.
+  /// Returns <b>false</b> if the stream is too short or holds a length larger
+  /// than the capacity of the destination. The value is then partially decoded.
+  ///\ingroup serialize
+  //***************************************************************************
+  template <typename T>
+  bool deserialize(etl::byte_stream_reader& stream, T& value)
+  {
+    return etl::serial_codec<T>::read(stream, value);
+  }
+} // namespace etl
+
+#endif
+#endif
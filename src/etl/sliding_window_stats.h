@@ -0,0 +1,398 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIDING_WINDOW_STATS_INCLUDED
+#define ETL_SLIDING_WINDOW_STATS_INCLUDED
+
+#include "platform.h"
+#include "circular_buffer.h"
+#include "deque.h"
+#include "functional.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "variance.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exact statistics of the last Window_Size samples.
+  /// The samples are held in an etl::circular_buffer.
+  /// The minimum and maximum are tracked with monotonic deques, so each costs
+  /// O(1) amortised per sample. The sum and sum of squares are kept as running
+  /// totals.
+  /// For floating point totals, the totals are relative to a shift near the
+  /// mean to avoid cancellation, and are recalculated from the window after
+  /// every Window_Size samples, so that rounding errors do not accumulate.
+  /// Integral totals are exact and unshifted, so unsigned types may be used.
+  ///\tparam T           The sample type.
+  ///\tparam Window_Size The number of samples in the window.
+  ///\tparam TCalc       The type used for the running totals.
+  ///\ingroup maths
+  //***************************************************************************
+  template <typename T, size_t Window_Size, typename TCalc = T>
+  class sliding_window_stats : public etl::unary_function<T, void>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "Window_Size must be greater than zero");
+
+    typedef T     value_type;
+    typedef TCalc calc_type;
+
+    static ETL_CONSTANT size_t Window = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    sliding_window_stats()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    sliding_window_stats(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a sample.
+    /// If the window is full then the oldest sample is removed.
+    //*********************************
+    void add(T value)
+    {
+      if ETL_IF_CONSTEXPR (etl::is_floating_point<TCalc>::value)
+      {
+        if (samples.empty())
+        {
+          shift = TCalc(value);
+        }
+      }
+
+      if (samples.full())
+      {
+        const TCalc oldest = TCalc(samples.front()) - shift;
+
+        sum -= oldest;
+        sum_of_squares -= oldest * oldest;
+      }
+
+      samples.push(value);
+
+      const TCalc delta = TCalc(value) - shift;
+
+      sum += delta;
+      sum_of_squares += delta * delta;
+
+      update_extremes(value);
+
+      if ETL_IF_CONSTEXPR (etl::is_floating_point<TCalc>::value)
+      {
+        if (++since_recalculation == Window_Size)
+        {
+          recalculate();
+        }
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// Add a block of samples.
+    /// Only the last Window_Size samples of a longer block are added, as the
+    /// others would immediately leave the window.
+    //*********************************
+    void add(etl::span<const T> values)
+    {
+      const T* first = values.data();
+      const T* last  = first + values.size();
+
+      if (values.size() >= Window_Size)
+      {
+        clear();
+        first = last - Window_Size;
+      }
+
+      add(first, last);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a sample.
+    //*********************************
+    void operator()(T value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a block of samples.
+    //*********************************
+    void operator()(etl::span<const T> values)
+    {
+      add(values);
+    }
+
+    //*********************************
+    /// Get the smallest sample in the window.
+    /// Returns T() if the window is empty.
+    //*********************************
+    T get_min() const
+    {
+      return minimums.empty() ? T() : minimums.front().value;
+    }
+
+    //*********************************
+    /// Get the largest sample in the window.
+    /// Returns T() if the window is empty.
+    //*********************************
+    T get_max() const
+    {
+      return maximums.empty() ? T() : maximums.front().value;
+    }
+
+    //*********************************
+    /// Get the sum of the samples in the window.
+    //*********************************
+    double get_sum() const
+    {
+      return (double(shift) * double(samples.size())) + double(sum);
+    }
+
+    //*********************************
+    /// Get the mean of the samples in the window.
+    //*********************************
+    double get_mean() const
+    {
+      if (samples.empty())
+      {
+        return 0.0;
+      }
+
+      return double(shift) + (double(sum) / double(samples.size()));
+    }
+
+    //*********************************
+    /// Get the variance of the samples in the window.
+    ///\param type etl::variance_type::Population or etl::variance_type::Sample.
+    //*********************************
+    double get_variance(bool type = etl::variance_type::Population) const
+    {
+      const double n       = double(samples.size());
+      const double divisor = (type == etl::variance_type::Population) ? n : n - 1.0;
+
+      if (divisor <= 0.0)
+      {
+        return 0.0;
+      }
+
+      const double sum_d = double(sum);
+      const double value = (double(sum_of_squares) - ((sum_d * sum_d) / n)) / divisor;
+
+      return (value > 0.0) ? value : 0.0;
+    }
+
+    //*********************************
+    /// Get the number of samples in the window.
+    //*********************************
+    size_t count() const
+    {
+      return samples.size();
+    }
+
+    //*********************************
+    /// Checks if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*********************************
+    /// Checks if the window is empty.
+    //*********************************
+    bool empty() const
+    {
+      return samples.empty();
+    }
+
+    //*********************************
+    /// Get the size of the window.
+    //*********************************
+    static ETL_CONSTEXPR size_t window_size()
+    {
+      return Window_Size;
+    }
+
+    //*********************************
+    /// Get the samples in the window, oldest first.
+    //*********************************
+    const etl::icircular_buffer<T>& get_samples() const
+    {
+      return samples;
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      samples.clear();
+      minimums.clear();
+      maximums.clear();
+
+      shift               = TCalc(0);
+      sum                 = TCalc(0);
+      sum_of_squares      = TCalc(0);
+      sequence            = 0U;
+      since_recalculation = 0U;
+    }
+
+  private:
+
+    //*********************************
+    /// A sample, with the number of its arrival.
+    //*********************************
+    struct extreme
+    {
+      T      value;
+      size_t sequence;
+    };
+
+    typedef etl::deque<extreme, Window_Size> extremes_t;
+
+    //*********************************
+    /// Removes expired samples and those that can no longer be extremes, then
+    /// adds the new sample.
+    //*********************************
+    void update_extremes(T value)
+    {
+      ++sequence;
+
+      extreme e;
+      e.value    = value;
+      e.sequence = sequence;
+
+      // Expire any that have left the window.
+      if (!minimums.empty() && ((sequence - minimums.front().sequence) >= Window_Size))
+      {
+        minimums.pop_front();
+      }
+
+      if (!maximums.empty() && ((sequence - maximums.front().sequence) >= Window_Size))
+      {
+        maximums.pop_front();
+      }
+
+      // Remove any that the new sample will outlive.
+      while (!minimums.empty() && !(minimums.back().value < value))
+      {
+        minimums.pop_back();
+      }
+
+      while (!maximums.empty() && !(value < maximums.back().value))
+      {
+        maximums.pop_back();
+      }
+
+      minimums.push_back(e);
+      maximums.push_back(e);
+    }
+
+    //*********************************
+    /// Recalculates the totals from the window, re-centred on the mean.
+    //*********************************
+    void recalculate()
+    {
+      shift = TCalc(get_mean());
+
+      TCalc new_sum            = TCalc(0);
+      TCalc new_sum_of_squares = TCalc(0);
+
+      typename etl::icircular_buffer<T>::const_iterator itr = samples.begin();
+
+      while (itr != samples.end())
+      {
+        const TCalc delta = TCalc(*itr) - shift;
+
+        new_sum += delta;
+        new_sum_of_squares += delta * delta;
+        ++itr;
+      }
+
+      sum                 = new_sum;
+      sum_of_squares      = new_sum_of_squares;
+      since_recalculation = 0U;
+    }
+
+    etl::circular_buffer<T, Window_Size> samples;  ///< The samples in the window.
+    extremes_t                           minimums; ///< Ascending candidates for the minimum.
+    extremes_t                           maximums; ///< Descending candidates for the maximum.
+    TCalc                                shift;    ///< The totals are of the samples minus the shift. Always zero for integral totals.
+    TCalc                                sum;
+    TCalc                                sum_of_squares;
+    size_t                               sequence;
+    size_t                               since_recalculation;
+  };
+
+  template <typename T, size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t sliding_window_stats<T, Window_Size, TCalc>::Window;
+} // namespace etl
+
+#endif
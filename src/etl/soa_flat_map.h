@@ -0,0 +1,860 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_MAP_INCLUDED
+#define ETL_SOA_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "iterator.h"
+#include "memory.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#include "private/soa_flat_search.h"
+
+#include <stddef.h>
+
+///\defgroup soa_flat_map soa_flat_map
+/// A flat_map with the keys and mapped values held in separate contiguous
+/// arrays (structure of arrays).
+/// Searches only read the key array, and may optionally use an Eytzinger
+/// layout of the keys.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized soa_flat_maps.
+  /// Can be used as a reference type for all soa_flat_maps containing a
+  /// specific type.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class isoa_flat_map : public etl::private_soa_flat::soa_key_search<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_soa_flat::soa_key_search<TKey, TKeyCompare> base_t;
+
+  public:
+
+    typedef TKey           key_type;
+    typedef TMapped        mapped_type;
+    typedef TKeyCompare    key_compare;
+    typedef mapped_type&   mapped_reference;
+    typedef const TMapped& const_mapped_reference;
+    typedef size_t         size_type;
+    typedef ptrdiff_t      difference_type;
+
+    //*************************************************************************
+    /// A reference to an element.
+    /// The key and mapped value are held in separate arrays, so a pair of
+    /// references stands in for a reference to a value_type.
+    //*************************************************************************
+    template <typename TMappedValue>
+    struct element_reference
+    {
+      element_reference(const key_type& first_, TMappedValue& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      const key_type& first;
+      TMappedValue&   second;
+    };
+
+    typedef element_reference<mapped_type>       reference;
+    typedef element_reference<const mapped_type> const_reference;
+
+    //*************************************************************************
+    /// Iterator over the parallel key and mapped value arrays.
+    //*************************************************************************
+    template <typename TMappedValue>
+    class iterator_type : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, element_reference<TMappedValue> >
+    {
+    public:
+
+      template <typename>
+      friend class iterator_type;
+
+      typedef element_reference<TMappedValue> reference;
+
+      //***********************************
+      /// Proxy returned by operator->.
+      //***********************************
+      class pointer
+      {
+      public:
+
+        explicit pointer(const reference& reference_)
+          : ref(reference_)
+        {
+        }
+
+        const reference* operator->() const
+        {
+          return &ref;
+        }
+
+      private:
+
+        reference ref;
+      };
+
+      //***********************************
+      iterator_type()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      //***********************************
+      iterator_type(const key_type* p_key_, TMappedValue* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      //***********************************
+      /// Conversion from a non-const iterator.
+      //***********************************
+      template <typename TOther>
+      iterator_type(const iterator_type<TOther>& other)
+        : p_key(other.p_key)
+        , p_mapped(other.p_mapped)
+      {
+      }
+
+      //***********************************
+      reference operator*() const
+      {
+        return reference(*p_key, *p_mapped);
+      }
+
+      //***********************************
+      pointer operator->() const
+      {
+        return pointer(**this);
+      }
+
+      //***********************************
+      reference operator[](difference_type n) const
+      {
+        return reference(p_key[n], p_mapped[n]);
+      }
+
+      //***********************************
+      /// The key of the element.
+      //***********************************
+      const key_type& key() const
+      {
+        return *p_key;
+      }
+
+      //***********************************
+      /// The mapped value of the element.
+      //***********************************
+      TMappedValue& mapped() const
+      {
+        return *p_mapped;
+      }
+
+      //***********************************
+      iterator_type& operator++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      //***********************************
+      iterator_type operator++(int)
+      {
+        iterator_type temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //***********************************
+      iterator_type& operator--()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      //***********************************
+      iterator_type operator--(int)
+      {
+        iterator_type temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //***********************************
+      iterator_type& operator+=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      //***********************************
+      iterator_type& operator-=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      //***********************************
+      friend iterator_type operator+(iterator_type lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      //***********************************
+      friend iterator_type operator+(difference_type n, iterator_type rhs)
+      {
+        return rhs += n;
+      }
+
+      //***********************************
+      friend iterator_type operator-(iterator_type lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      //***********************************
+      friend difference_type operator-(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator==(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator!=(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key != rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator<(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator>(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key > rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator<=(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key <= rhs.p_key;
+      }
+
+      //***********************************
+      friend bool operator>=(const iterator_type& lhs, const iterator_type& rhs)
+      {
+        return lhs.p_key >= rhs.p_key;
+      }
+
+    private:
+
+      const key_type* p_key;
+      TMappedValue*   p_mapped;
+    };
+
+    typedef iterator_type<mapped_type>       iterator;
+    typedef iterator_type<const mapped_type> const_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this->p_keys, p_mapped);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this->p_keys, p_mapped);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this->p_keys + this->current_size, p_mapped + this->current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this->p_keys + this->current_size, p_mapped + this->current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the contiguous mapped values, in key order.
+    //*************************************************************************
+    mapped_type* mapped_values()
+    {
+      return p_mapped;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the contiguous mapped values, in key order.
+    //*************************************************************************
+    const mapped_type* mapped_values() const
+    {
+      return p_mapped;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_full if a new key
+    /// will not fit. If the error does not throw, the key is not inserted and
+    /// a reference to the value of the last element is returned.
+    //*************************************************************************
+    mapped_reference operator[](const key_type& key)
+    {
+      size_type i = this->lower_bound_index(key);
+
+      if (!this->key_at_is(i, key))
+      {
+        if (!insert_at(i, key, mapped_type()))
+        {
+          // The map is full, so the last element exists.
+          i = this->current_size - 1U;
+        }
+      }
+
+      return p_mapped[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_out_of_bounds if
+    /// the key is not in the map.
+    //*************************************************************************
+    mapped_reference at(const key_type& key)
+    {
+      const size_type i = this->find_index(key);
+
+      ETL_ASSERT(i != this->current_size, ETL_ERROR(soa_flat_out_of_bounds));
+
+      return p_mapped[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_out_of_bounds if
+    /// the key is not in the map.
+    //*************************************************************************
+    const_mapped_reference at(const key_type& key) const
+    {
+      const size_type i = this->find_index(key);
+
+      ETL_ASSERT(i != this->current_size, ETL_ERROR(soa_flat_out_of_bounds));
+
+      return p_mapped[i];
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      return begin() + difference_type(this->find_index(key));
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return A const_iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return begin() + difference_type(this->find_index(key));
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains an element with key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return this->find_index(key) != this->current_size;
+    }
+
+    //*************************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    size_type count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*************************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return begin() + difference_type(this->lower_bound_index(key));
+    }
+
+    //*************************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return begin() + difference_type(this->lower_bound_index(key));
+    }
+
+    //*************************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*************************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      const size_type i = this->lower_bound_index(key);
+
+      return begin() + difference_type(this->key_at_is(i, key) ? i + 1U : i);
+    }
+
+    //*************************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      const size_type i = this->lower_bound_index(key);
+
+      return begin() + difference_type(this->key_at_is(i, key) ? i + 1U : i);
+    }
+
+    //*************************************************************************
+    /// Inserts a value to the map.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_full if the map is
+    /// already full.
+    ///\param key   The key to insert.
+    ///\param value The mapped value to insert.
+    ///\return A pair of the iterator to the element and whether it was
+    /// inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const key_type& key, const mapped_type& value)
+    {
+      const size_type i = this->lower_bound_index(key);
+
+      if (this->key_at_is(i, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(begin() + difference_type(i), false);
+      }
+
+      const bool inserted = insert_at(i, key, value);
+
+      return ETL_OR_STD::pair<iterator, bool>(begin() + difference_type(i), inserted);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values to the map, in any order.
+    /// Each element is searched for and inserted individually.
+    /// The range must dereference to a pair like type with 'first' and
+    /// 'second' members.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(first->first, first->second);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key, with a
+    /// single O(N + M) merge, rather than a search and a shift per element.
+    /// Keys already in the map are left unchanged.
+    /// The range must be bidirectional and dereference to a pair like type
+    /// with 'first' and 'second' members.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_unsorted if the
+    /// range is not strictly increasing, or soa_flat_full if the new keys
+    /// will not fit. In either case the map is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      size_type  n_new;
+      const bool is_sorted = this->count_new_keys(first, last, get_key<TIterator>(), n_new);
+
+      if (!is_sorted || (n_new > this->available()))
+      {
+        ETL_ASSERT(is_sorted, ETL_ERROR(soa_flat_unsorted));
+        ETL_ASSERT(n_new <= this->available(), ETL_ERROR(soa_flat_full));
+        return;
+      }
+
+      if (n_new == 0U)
+      {
+        return;
+      }
+
+      // Merge from the back, so that each existing element moves once.
+      const size_type old_size = this->current_size;
+      size_type       r        = old_size;            // Existing elements below r are not yet placed.
+      size_type       w        = old_size + n_new;    // Slots at and above w are filled.
+
+      TIterator itr = last;
+      --itr;
+
+      while (w != r)
+      {
+        const key_type& key = itr->first;
+
+        if ((r != 0U) && this->compare(key, this->p_keys[r - 1U]))
+        {
+          // The existing key is greater.
+          --w;
+          --r;
+          private_soa_flat::place_value(this->p_keys, old_size, w, private_soa_flat::move_value(this->p_keys[r]));
+          private_soa_flat::place_value(p_mapped, old_size, w, private_soa_flat::move_value(p_mapped[r]));
+        }
+        else
+        {
+          if ((r == 0U) || this->compare(this->p_keys[r - 1U], key))
+          {
+            // The new key is greater.
+            --w;
+            private_soa_flat::place_value(this->p_keys, old_size, w, key);
+            private_soa_flat::place_value(p_mapped, old_size, w, itr->second);
+          }
+
+          if (itr == first)
+          {
+            break;
+          }
+
+          --itr;
+        }
+      }
+
+      this->current_size = old_size + n_new;
+      this->rebuild_layout();
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key.
+    /// Equivalent to insert_sorted(first, last).
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_sorted(first, last);
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values, sorted by strictly increasing key.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_unsorted if the
+    /// range is not strictly increasing, or soa_flat_full if it will not fit.
+    ///\param first The first element to assign.
+    ///\param last  The last + 1 element to assign.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_sorted(first, last);
+    }
+
+    //*************************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*************************************************************************
+    size_type erase(const key_type& key)
+    {
+      const size_type i = this->find_index(key);
+
+      if (i == this->current_size)
+      {
+        return 0U;
+      }
+
+      erase_at(i);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const size_type i = static_cast<size_type>(i_element - cbegin());
+
+      erase_at(i);
+
+      return begin() + difference_type(i);
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0U; i < this->current_size; ++i)
+      {
+        p_mapped[i].~TMapped();
+      }
+
+      this->clear_keys();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    isoa_flat_map(TKey* p_keys_, TMapped* p_mapped_, TKey* p_layout_keys_, size_t* p_layout_index_, size_type max_size_)
+      : base_t(p_keys_, p_layout_keys_, p_layout_index_, max_size_)
+      , p_mapped(p_mapped_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~isoa_flat_map()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Extracts the key from a pair like element.
+    //*************************************************************************
+    template <typename TIterator>
+    struct get_key
+    {
+      const key_type& operator()(const TIterator& itr) const
+      {
+        return itr->first;
+      }
+    };
+
+    //*************************************************************************
+    /// Inserts a new key and value at index 'i'.
+    //*************************************************************************
+    bool insert_at(size_type i, const key_type& key, const mapped_type& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(soa_flat_full), false);
+
+      private_soa_flat::insert_value(this->p_keys, this->current_size, i, key);
+      private_soa_flat::insert_value(p_mapped, this->current_size, i, value);
+      ++this->current_size;
+      this->rebuild_layout();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the key and value at index 'i'.
+    //*************************************************************************
+    void erase_at(size_type i)
+    {
+      private_soa_flat::erase_value(this->p_keys, this->current_size, i);
+      private_soa_flat::erase_value(p_mapped, this->current_size, i);
+      --this->current_size;
+      this->rebuild_layout();
+    }
+
+    TMapped* p_mapped;
+  };
+
+  //***************************************************************************
+  /// A flat_map with a fixed capacity, holding keys and mapped values in
+  /// separate contiguous arrays.
+  ///\tparam TKey              The key type.
+  ///\tparam TMapped           The mapped type.
+  ///\tparam Max_Size_         The maximum number of elements.
+  ///\tparam TKeyCompare       The key comparison function.
+  ///\tparam Eytzinger_Layout_ If true, searches use an additional copy of the
+  /// keys in Eytzinger order. Faster searches for large read-mostly maps, at
+  /// the cost of the extra storage and an O(N) rebuild on modification.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Max_Size_, typename TKeyCompare = etl::less<TKey>, bool Eytzinger_Layout_ = false>
+  class soa_flat_map : public etl::isoa_flat_map<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::isoa_flat_map<TKey, TMapped, TKeyCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size_ > 0U, "Max_Size_ must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_SIZE         = Max_Size_;
+    static ETL_CONSTANT bool   Eytzinger_Layout = Eytzinger_Layout_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_map()
+      : base_t(key_storage, mapped_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_map(const soa_flat_map& other)
+      : base_t(key_storage, mapped_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+      this->insert_sorted(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range, in any order.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map(TIterator first, TIterator last)
+      : base_t(key_storage, mapped_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+      this->insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_map& operator=(const soa_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->insert_sorted(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Layout_Size = Eytzinger_Layout_ ? Max_Size_ + 1U : 1U;
+
+    //*************************************************************************
+    TKey* layout_keys()
+    {
+      return Eytzinger_Layout_ ? static_cast<TKey*>(layout_key_storage) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    size_t* layout_index()
+    {
+      return Eytzinger_Layout_ ? layout_index_storage : ETL_NULLPTR;
+    }
+
+    etl::uninitialized_buffer_of<TKey, Max_Size_>      key_storage;
+    etl::uninitialized_buffer_of<TMapped, Max_Size_>   mapped_storage;
+    etl::uninitialized_buffer_of<TKey, Layout_Size>    layout_key_storage;
+    size_t                                             layout_index_storage[Layout_Size];
+  };
+
+  template <typename TKey, typename TMapped, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT size_t soa_flat_map<TKey, TMapped, Max_Size_, TKeyCompare, Eytzinger_Layout_>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT bool soa_flat_map<TKey, TMapped, Max_Size_, TKeyCompare, Eytzinger_Layout_>::Eytzinger_Layout;
+
+  template <typename TKey, typename TMapped, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT size_t soa_flat_map<TKey, TMapped, Max_Size_, TKeyCompare, Eytzinger_Layout_>::Layout_Size;
+} // namespace etl
+
+#endif
@@ -0,0 +1,503 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_SET_INCLUDED
+#define ETL_SOA_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "iterator.h"
+#include "memory.h"
+#include "utility.h"
+
+#include "private/soa_flat_search.h"
+
+#include <stddef.h>
+
+///\defgroup soa_flat_set soa_flat_set
+/// A flat_set with the keys held in a contiguous array.
+/// Searches are branchless, and may optionally use an Eytzinger layout of
+/// the keys.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized soa_flat_sets.
+  /// Can be used as a reference type for all soa_flat_sets containing a
+  /// specific type.
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class isoa_flat_set : public etl::private_soa_flat::soa_key_search<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_soa_flat::soa_key_search<TKey, TKeyCompare> base_t;
+
+  public:
+
+    typedef TKey                                  key_type;
+    typedef TKey                                  value_type;
+    typedef TKeyCompare                           key_compare;
+    typedef TKeyCompare                           value_compare;
+    typedef const value_type&                     reference;
+    typedef const value_type&                     const_reference;
+    typedef const value_type*                     pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+    typedef const value_type*                     iterator;
+    typedef const value_type*                     const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator> reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return this->p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return this->p_keys + this->current_size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return begin() + this->find_index(key);
+    }
+
+    //*************************************************************************
+    /// Checks if the set contains an element with key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return this->find_index(key) != this->current_size;
+    }
+
+    //*************************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    size_type count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return begin() + this->lower_bound_index(key);
+    }
+
+    //*************************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      const size_type i = this->lower_bound_index(key);
+
+      return begin() + (this->key_at_is(i, key) ? i + 1U : i);
+    }
+
+    //*************************************************************************
+    /// Inserts a value to the set.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_full if the set is
+    /// already full.
+    ///\param value The value to insert.
+    ///\return A pair of the iterator to the element and whether it was
+    /// inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      const size_type i = this->lower_bound_index(value);
+
+      if (this->key_at_is(i, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(begin() + i, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(soa_flat_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      private_soa_flat::insert_value(this->p_keys, this->current_size, i, value);
+      ++this->current_size;
+      this->rebuild_layout();
+
+      return ETL_OR_STD::pair<iterator, bool>(begin() + i, true);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values to the set, in any order.
+    /// Each element is searched for and inserted individually.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a range of strictly increasing values with a single O(N + M)
+    /// merge, rather than a search and a shift per element.
+    /// The range must be bidirectional.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_unsorted if the
+    /// range is not strictly increasing, or soa_flat_full if the new values
+    /// will not fit. In either case the set is unchanged.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      size_type  n_new;
+      const bool is_sorted = this->count_new_keys(first, last, get_key<TIterator>(), n_new);
+
+      if (!is_sorted || (n_new > this->available()))
+      {
+        ETL_ASSERT(is_sorted, ETL_ERROR(soa_flat_unsorted));
+        ETL_ASSERT(n_new <= this->available(), ETL_ERROR(soa_flat_full));
+        return;
+      }
+
+      if (n_new == 0U)
+      {
+        return;
+      }
+
+      // Merge from the back, so that each existing element moves once.
+      const size_type old_size = this->current_size;
+      size_type       r        = old_size;            // Existing elements below r are not yet placed.
+      size_type       w        = old_size + n_new;    // Slots at and above w are filled.
+
+      TIterator itr = last;
+      --itr;
+
+      while (w != r)
+      {
+        const key_type& key = *itr;
+
+        if ((r != 0U) && this->compare(key, this->p_keys[r - 1U]))
+        {
+          // The existing key is greater.
+          --w;
+          --r;
+          private_soa_flat::place_value(this->p_keys, old_size, w, private_soa_flat::move_value(this->p_keys[r]));
+        }
+        else
+        {
+          if ((r == 0U) || this->compare(this->p_keys[r - 1U], key))
+          {
+            // The new key is greater.
+            --w;
+            private_soa_flat::place_value(this->p_keys, old_size, w, key);
+          }
+
+          if (itr == first)
+          {
+            break;
+          }
+
+          --itr;
+        }
+      }
+
+      this->current_size = old_size + n_new;
+      this->rebuild_layout();
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values, sorted by strictly increasing key.
+    /// Equivalent to insert_sorted(first, last).
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_sorted(first, last);
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values, sorted by strictly increasing key.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits soa_flat_unsorted if the
+    /// range is not strictly increasing, or soa_flat_full if it will not fit.
+    ///\param first The first element to assign.
+    ///\param last  The last + 1 element to assign.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_sorted(first, last);
+    }
+
+    //*************************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*************************************************************************
+    size_type erase(const key_type& key)
+    {
+      const size_type i = this->find_index(key);
+
+      if (i == this->current_size)
+      {
+        return 0U;
+      }
+
+      erase_at(i);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const size_type i = static_cast<size_type>(i_element - begin());
+
+      erase_at(i);
+
+      return begin() + i;
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      this->clear_keys();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    isoa_flat_set(TKey* p_keys_, TKey* p_layout_keys_, size_t* p_layout_index_, size_type max_size_)
+      : base_t(p_keys_, p_layout_keys_, p_layout_index_, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~isoa_flat_set()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Extracts the key from an element.
+    //*************************************************************************
+    template <typename TIterator>
+    struct get_key
+    {
+      const key_type& operator()(const TIterator& itr) const
+      {
+        return *itr;
+      }
+    };
+
+    //*************************************************************************
+    /// Erases the key at index 'i'.
+    //*************************************************************************
+    void erase_at(size_type i)
+    {
+      private_soa_flat::erase_value(this->p_keys, this->current_size, i);
+      --this->current_size;
+      this->rebuild_layout();
+    }
+  };
+
+  //***************************************************************************
+  /// A flat_set with a fixed capacity, holding the keys in a contiguous array.
+  ///\tparam TKey              The key type.
+  ///\tparam Max_Size_         The maximum number of elements.
+  ///\tparam TKeyCompare       The key comparison function.
+  ///\tparam Eytzinger_Layout_ If true, searches use an additional copy of the
+  /// keys in Eytzinger order. Faster searches for large read-mostly sets, at
+  /// the cost of the extra storage and an O(N) rebuild on modification.
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, size_t Max_Size_, typename TKeyCompare = etl::less<TKey>, bool Eytzinger_Layout_ = false>
+  class soa_flat_set : public etl::isoa_flat_set<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::isoa_flat_set<TKey, TKeyCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE         = Max_Size_;
+    static ETL_CONSTANT bool   Eytzinger_Layout = Eytzinger_Layout_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_set()
+      : base_t(key_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_set(const soa_flat_set& other)
+      : base_t(key_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+      this->insert_sorted(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range, in any order.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_set(TIterator first, TIterator last)
+      : base_t(key_storage, layout_keys(), layout_index(), Max_Size_)
+    {
+      this->insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_set& operator=(const soa_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->insert_sorted(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Layout_Size = Eytzinger_Layout_ ? Max_Size_ + 1U : 1U;
+
+    //*************************************************************************
+    TKey* layout_keys()
+    {
+      return Eytzinger_Layout_ ? static_cast<TKey*>(layout_key_storage) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    size_t* layout_index()
+    {
+      return Eytzinger_Layout_ ? layout_index_storage : ETL_NULLPTR;
+    }
+
+    etl::uninitialized_buffer_of<TKey, Max_Size_>   key_storage;
+    etl::uninitialized_buffer_of<TKey, Layout_Size> layout_key_storage;
+    size_t                                          layout_index_storage[Layout_Size];
+  };
+
+  template <typename TKey, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT size_t soa_flat_set<TKey, Max_Size_, TKeyCompare, Eytzinger_Layout_>::MAX_SIZE;
+
+  template <typename TKey, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT bool soa_flat_set<TKey, Max_Size_, TKeyCompare, Eytzinger_Layout_>::Eytzinger_Layout;
+
+  template <typename TKey, size_t Max_Size_, typename TKeyCompare, bool Eytzinger_Layout_>
+  ETL_CONSTANT size_t soa_flat_set<TKey, Max_Size_, TKeyCompare, Eytzinger_Layout_>::Layout_Size;
+} // namespace etl
+
+#endif
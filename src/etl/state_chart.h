@@ -32,7 +32,11 @@ SOFTWARE.
 #include "platform.h"
 #include "array.h"
 #include "array_view.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "integral_limits.h"
 #include "nullptr.h"
+#include "static_assert.h"
 #include "utility.h"
 
 #include <stdint.h>
@@ -140,6 +144,344 @@ namespace etl
     };
   } // namespace state_chart_traits
 
+  //***************************************************************************
+  /// Base exception class for state_chart.
+  //***************************************************************************
+  class state_chart_exception : public etl::exception
+  {
+  public:
+
+    state_chart_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for tables that do not fit the lookup.
+  //***************************************************************************
+  class state_chart_lookup_exception : public etl::state_chart_exception
+  {
+  public:
+
+    state_chart_lookup_exception(string_type file_name_, numeric_type line_number_)
+      : etl::state_chart_exception(ETL_ERROR_TEXT("state_chart:lookup", ETL_STATE_CHART_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A dense index of the transition and state tables of a state chart.
+  /// The transitions for each state and event, and the 'from any state'
+  /// transitions for each event, are listed in table order, so the first
+  /// matching transition is found without scanning the transition table.
+  /// States are found by id with a single array access.
+  /// If the tables do not fit, an etl::state_chart_lookup_exception is raised
+  /// and the lookup is marked as invalid, in which case the state chart falls
+  /// back to searching the tables.
+  /// The storage is supplied by etl::state_chart_lookup.
+  //***************************************************************************
+  class istate_chart_lookup
+  {
+  public:
+
+    typedef uint_least16_t index_t;
+
+    static ETL_CONSTANT index_t No_Index = etl::integral_limits<index_t>::max;
+
+    //*************************************************************************
+    /// The transitions that may match a state and event, in table order.
+    //*************************************************************************
+    class transition_range
+    {
+    public:
+
+      ETL_CONSTEXPR14 transition_range()
+        : p_specific(ETL_NULLPTR)
+        , p_specific_end(ETL_NULLPTR)
+        , p_any(ETL_NULLPTR)
+        , p_any_end(ETL_NULLPTR)
+      {
+      }
+
+      ETL_CONSTEXPR14 transition_range(const index_t* p_specific_, const index_t* p_specific_end_, const index_t* p_any_, const index_t* p_any_end_)
+        : p_specific(p_specific_)
+        , p_specific_end(p_specific_end_)
+        , p_any(p_any_)
+        , p_any_end(p_any_end_)
+      {
+      }
+
+      //***********************************
+      /// Gets the index of the next transition, or No_Index if there are no
+      /// more.
+      //***********************************
+      ETL_CONSTEXPR14 index_t next()
+      {
+        const bool has_specific = (p_specific != p_specific_end);
+        const bool has_any      = (p_any != p_any_end);
+
+        if (has_specific && (!has_any || (*p_specific < *p_any)))
+        {
+          return *p_specific++;
+        }
+        else if (has_any)
+        {
+          return *p_any++;
+        }
+        else
+        {
+          return No_Index;
+        }
+      }
+
+    private:
+
+      const index_t* p_specific;
+      const index_t* p_specific_end;
+      const index_t* p_any;
+      const index_t* p_any_end;
+    };
+
+    //*************************************************************************
+    /// Checks if the lookup was built from the tables.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    /// Gets the transitions that may match the state and event.
+    /// A valid lookup has no transitions from a state id outside of it, but
+    /// the 'from any state' transitions still match such a state.
+    //*************************************************************************
+    ETL_CONSTEXPR14 transition_range find_transitions(state_chart_traits::state_id_t state_id, state_chart_traits::event_id_t event_id) const
+    {
+      if (event_id >= max_events)
+      {
+        return transition_range();
+      }
+
+      if (state_id >= max_states)
+      {
+        return transition_range(ETL_NULLPTR, ETL_NULLPTR, p_entries + p_any_cells[event_id], p_entries + p_any_cells[event_id + 1U]);
+      }
+
+      const size_t cell = (size_t(state_id) * max_events) + event_id;
+
+      return transition_range(p_entries + p_cells[cell], p_entries + p_cells[cell + 1U],
+                              p_entries + p_any_cells[event_id], p_entries + p_any_cells[event_id + 1U]);
+    }
+
+    //*************************************************************************
+    /// Gets the index of the state in the state table, or No_Index.
+    //*************************************************************************
+    ETL_CONSTEXPR14 index_t find_state(state_chart_traits::state_id_t state_id) const
+    {
+      return (state_id < max_states) ? p_states[state_id] : No_Index;
+    }
+
+    //*************************************************************************
+    /// Builds the lookup from the tables.
+    ///\return <b>true</b> if the tables fit the lookup.
+    //*************************************************************************
+    template <typename TTransition, typename TState>
+    ETL_CONSTEXPR14 bool build(const TTransition* transitions, size_t n_transitions, const TState* states, size_t n_states)
+    {
+      valid = false;
+
+      const size_t n_cells = max_states * max_events;
+
+      for (size_t i = 0U; i <= n_cells; ++i)
+      {
+        p_cells[i] = 0U;
+      }
+
+      for (size_t i = 0U; i <= max_events; ++i)
+      {
+        p_any_cells[i] = 0U;
+      }
+
+      for (size_t i = 0U; i < max_states; ++i)
+      {
+        p_states[i] = No_Index;
+      }
+
+      // A lookup with no states is disabled.
+      if (max_states == 0U)
+      {
+        return false;
+      }
+
+      bool fits = (n_transitions <= max_transitions) && ((transitions != ETL_NULLPTR) || (n_transitions == 0U));
+
+      // Count the transitions for each state and event.
+      for (size_t i = 0U; fits && (i < n_transitions); ++i)
+      {
+        const TTransition& t = transitions[i];
+
+        fits = (t.event_id < max_events) && (t.next_state_id < max_states) && (t.from_any_state || (t.current_state_id < max_states));
+
+        if (fits)
+        {
+          if (t.from_any_state)
+          {
+            ++p_any_cells[t.event_id + 1U];
+          }
+          else
+          {
+            ++p_cells[(size_t(t.current_state_id) * max_events) + t.event_id + 1U];
+          }
+        }
+      }
+
+      for (size_t i = 0U; fits && (i < n_states); ++i)
+      {
+        fits = (states[i].state_id < max_states);
+
+        // The first entry for a state id is the one that is used.
+        if (fits && (p_states[states[i].state_id] == No_Index))
+        {
+          p_states[states[i].state_id] = index_t(i);
+        }
+      }
+
+      ETL_ASSERT(fits, ETL_ERROR(etl::state_chart_lookup_exception));
+
+      if (!fits)
+      {
+        return false;
+      }
+
+      // Convert the counts to offsets. The 'from any state' transitions follow the others.
+      for (size_t i = 0U; i < n_cells; ++i)
+      {
+        p_cells[i + 1U] = index_t(p_cells[i + 1U] + p_cells[i]);
+      }
+
+      p_any_cells[0] = p_cells[n_cells];
+
+      for (size_t i = 0U; i < max_events; ++i)
+      {
+        p_any_cells[i + 1U] = index_t(p_any_cells[i + 1U] + p_any_cells[i]);
+      }
+
+      // Place the transitions, using the start of each cell as its insertion point.
+      for (size_t i = 0U; i < n_transitions; ++i)
+      {
+        const TTransition& t = transitions[i];
+
+        index_t& position = t.from_any_state ? p_any_cells[t.event_id] : p_cells[(size_t(t.current_state_id) * max_events) + t.event_id];
+
+        p_entries[position++] = index_t(i);
+      }
+
+      // Each insertion point is now the start of the next cell, so move them back.
+      for (size_t i = n_cells; i > 0U; --i)
+      {
+        p_cells[i] = p_cells[i - 1U];
+      }
+
+      p_cells[0] = 0U;
+
+      for (size_t i = max_events; i > 0U; --i)
+      {
+        p_any_cells[i] = p_any_cells[i - 1U];
+      }
+
+      p_any_cells[0] = p_cells[n_cells];
+
+      valid = true;
+
+      return true;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR14 istate_chart_lookup(index_t* p_cells_, index_t* p_any_cells_, index_t* p_entries_, index_t* p_states_, size_t max_states_,
+                                        size_t max_events_, size_t max_transitions_)
+      : p_cells(p_cells_)
+      , p_any_cells(p_any_cells_)
+      , p_entries(p_entries_)
+      , p_states(p_states_)
+      , max_states(max_states_)
+      , max_events(max_events_)
+      , max_transitions(max_transitions_)
+      , valid(false)
+    {
+    }
+
+  private:
+
+    // Disabled
+    istate_chart_lookup(const istate_chart_lookup&) ETL_DELETE;
+    istate_chart_lookup& operator=(const istate_chart_lookup&) ETL_DELETE;
+
+    index_t*     p_cells;         ///< The start of the transitions for each state and event, with the end of the last.
+    index_t*     p_any_cells;     ///< The start of the 'from any state' transitions for each event, with the end of the last.
+    index_t*     p_entries;       ///< The transition indexes.
+    index_t*     p_states;        ///< The state table index for each state id.
+    const size_t max_states;
+    const size_t max_events;
+    const size_t max_transitions;
+    bool         valid;
+  };
+
+  //***************************************************************************
+  /// The storage for a state chart lookup.
+  /// The lookup holds (Max_States * Max_Events) + Max_Events + Max_States +
+  /// Max_Transitions + 2 indexes.
+  ///\tparam Max_States      The state ids must be less than this.
+  ///\tparam Max_Events      The event ids must be less than this.
+  ///\tparam Max_Transitions The maximum size of the transition table.
+  //***************************************************************************
+  template <size_t Max_States, size_t Max_Events, size_t Max_Transitions>
+  class state_chart_lookup : public istate_chart_lookup
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Transitions < istate_chart_lookup::No_Index, "Max_Transitions too large");
+
+    //*************************************************************************
+    /// Constructor.
+    /// The lookup must be built by a state chart, or by build().
+    //*************************************************************************
+    ETL_CONSTEXPR14 state_chart_lookup()
+      : istate_chart_lookup(cells, any_cells, entries, states, Max_States, Max_Events, Max_Transitions)
+      , cells()
+      , any_cells()
+      , entries()
+      , states()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Builds the lookup from the tables.
+    //*************************************************************************
+    template <typename TTransition, typename TState>
+    ETL_CONSTEXPR14 state_chart_lookup(const TTransition* transition_table, size_t n_transitions, const TState* state_table, size_t n_states)
+      : istate_chart_lookup(cells, any_cells, entries, states, Max_States, Max_Events, Max_Transitions)
+      , cells()
+      , any_cells()
+      , entries()
+      , states()
+    {
+      this->build(transition_table, n_transitions, state_table, n_states);
+    }
+
+  private:
+
+    index_t cells[(Max_States * Max_Events) + 1U];
+    index_t any_cells[Max_Events + 1U];
+    index_t entries[Max_Transitions + 1U];
+    index_t states[Max_States + 1U];
+  };
+
   //***************************************************************************
   /// For non-void parameter types
   //***************************************************************************
@@ -214,10 +556,14 @@ namespace etl
   /// Simple Finite State Machine
   /// Compile time tables.
   /// Event has no parameter.
+  /// If Max_States is not zero, events are dispatched through an
+  /// etl::state_chart_lookup of the tables. State ids must be less than
+  /// Max_States and event ids less than Max_Events. The lookup is built during
+  /// static initialisation, at compile time if the tables are constexpr.
   //***************************************************************************
   template <typename TObject, TObject& TObject_Ref, const etl::state_chart_traits::transition<TObject, void>* Transition_Table_Begin,
             size_t Transition_Table_Size, const etl::state_chart_traits::state<TObject>* State_Table_Begin, size_t State_Table_Size,
-            etl::state_chart_traits::state_id_t Initial_State>
+            etl::state_chart_traits::state_id_t Initial_State, size_t Max_States = 0U, size_t Max_Events = 0U>
   class state_chart_ct : public istate_chart<void>
   {
   public:
@@ -288,73 +634,107 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
-
-        // Keep looping until we execute a transition or reach the end of the
-        // table.
-        while (t != (Transition_Table_Begin + Transition_Table_Size))
+        if (lookup.is_valid())
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          istate_chart_lookup::transition_range range = lookup.find_transitions(this->current_state_id, event_id);
 
-          // Found an entry?
-          if (t != (Transition_Table_Begin + Transition_Table_Size))
+          // Execute the first transition whose guard passes.
+          for (istate_chart_lookup::index_t i = range.next(); i != istate_chart_lookup::No_Index; i = range.next())
           {
-            // Shall we execute the transition?
+            const transition* t = Transition_Table_Begin + i;
+
             if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
+              execute_transition(*t);
+              break;
+            }
+          }
+        }
+        else
+        {
+          const transition* t = Transition_Table_Begin;
+
+          // Keep looping until we execute a transition or reach the end of the
+          // table.
+          while (t != (Transition_Table_Begin + Transition_Table_Size))
+          {
+            // Scan the transition table from the latest position.
+            t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+
+            // Found an entry?
+            if (t != (Transition_Table_Begin + Transition_Table_Size))
+            {
+              // Shall we execute the transition?
+              if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
               {
-                (TObject_Ref.*t->action)();
-              }
+                execute_transition(*t);
 
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
+                t = (Transition_Table_Begin + Transition_Table_Size);
+              }
+              else
               {
-                const state* s;
+                // Start the search from the next item in the table.
+                ++t;
+              }
+            }
+          }
+        }
+      }
+    }
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+  private:
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_exit))();
-                }
+    //*************************************************************************
+    /// Executes the action of a transition and changes state.
+    //*************************************************************************
+    void execute_transition(const transition& t)
+    {
+      // Shall we execute the action?
+      if (t.action != ETL_NULLPTR)
+      {
+        (TObject_Ref.*t.action)();
+      }
 
-                this->current_state_id = t->next_state_id;
+      // Changing state?
+      if (this->current_state_id != t.next_state_id)
+      {
+        const state* s;
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+        // See if we have a state item for the current state.
+        s = find_state(this->current_state_id);
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_entry))();
-                }
-              }
+        // If the current state has an 'on_exit' then call it.
+        if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
+        {
+          (TObject_Ref.*(s->on_exit))();
+        }
 
-              t = (Transition_Table_Begin + Transition_Table_Size);
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
-          }
+        this->current_state_id = t.next_state_id;
+
+        // See if we have a state item for the new state.
+        s = find_state(this->current_state_id);
+
+        // If the new state has an 'on_entry' then call it.
+        if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
+        {
+          (TObject_Ref.*(s->on_entry))();
         }
       }
     }
 
-  private:
-
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
+      if (lookup.is_valid())
+      {
+        const istate_chart_lookup::index_t index = lookup.find_state(state_id);
+
+        return (index == istate_chart_lookup::No_Index) ? (State_Table_Begin + State_Table_Size) : (State_Table_Begin + index);
+      }
+
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
     }
 
@@ -396,18 +776,34 @@ namespace etl
     state_chart_ct(const state_chart_ct&) ETL_DELETE;
     state_chart_ct& operator=(const state_chart_ct&) ETL_DELETE;
 
+    typedef etl::state_chart_lookup<Max_States, Max_Events, (Max_States == 0U) ? 0U : Transition_Table_Size> lookup_t;
+
+    static const lookup_t lookup; ///< The lookup of the tables. Not valid if Max_States is zero.
+
     bool started; ///< Set if the state chart has been started.
   };
 
+  template <typename TObject, TObject& TObject_Ref, const etl::state_chart_traits::transition<TObject, void>* Transition_Table_Begin,
+            size_t Transition_Table_Size, const etl::state_chart_traits::state<TObject>* State_Table_Begin, size_t State_Table_Size,
+            etl::state_chart_traits::state_id_t Initial_State, size_t Max_States, size_t Max_Events>
+  const typename state_chart_ct<TObject, TObject_Ref, Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size, Initial_State,
+                                Max_States, Max_Events>::lookup_t
+    state_chart_ct<TObject, TObject_Ref, Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size, Initial_State, Max_States,
+                   Max_Events>::lookup(Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size);
+
   //***************************************************************************
   /// Simple Finite State Machine
   /// Compile time tables.
   /// Event has parameter.
+  /// If Max_States is not zero, events are dispatched through an
+  /// etl::state_chart_lookup of the tables. State ids must be less than
+  /// Max_States and event ids less than Max_Events. The lookup is built during
+  /// static initialisation, at compile time if the tables are constexpr.
   //***************************************************************************
   template <typename TObject, typename TParameter, TObject& TObject_Ref,
             const etl::state_chart_traits::transition<TObject, TParameter>* Transition_Table_Begin, size_t Transition_Table_Size,
             const etl::state_chart_traits::state<TObject>* State_Table_Begin, size_t State_Table_Size,
-            etl::state_chart_traits::state_id_t Initial_State>
+            etl::state_chart_traits::state_id_t Initial_State, size_t Max_States = 0U, size_t Max_Events = 0U>
   class state_chart_ctp : public istate_chart<TParameter>
   {
   public:
@@ -478,77 +874,111 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
-
-        // Keep looping until we execute a transition or reach the end of the
-        // table.
-        while (t != (Transition_Table_Begin + Transition_Table_Size))
+        if (lookup.is_valid())
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          istate_chart_lookup::transition_range range = lookup.find_transitions(this->current_state_id, event_id);
 
-          // Found an entry?
-          if (t != (Transition_Table_Begin + Transition_Table_Size))
+          // Execute the first transition whose guard passes.
+          for (istate_chart_lookup::index_t i = range.next(); i != istate_chart_lookup::No_Index; i = range.next())
           {
-            // Shall we execute the transition?
+            const transition* t = Transition_Table_Begin + i;
+
             if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
+              execute_transition(*t, data);
+              break;
+            }
+          }
+        }
+        else
+        {
+          const transition* t = Transition_Table_Begin;
+
+          // Keep looping until we execute a transition or reach the end of the
+          // table.
+          while (t != (Transition_Table_Begin + Transition_Table_Size))
+          {
+            // Scan the transition table from the latest position.
+            t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+
+            // Found an entry?
+            if (t != (Transition_Table_Begin + Transition_Table_Size))
+            {
+              // Shall we execute the transition?
+              if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
               {
+                execute_transition(*t, data);
+
+                t = (Transition_Table_Begin + Transition_Table_Size);
+              }
+              else
+              {
+                // Start the search from the next item in the table.
+                ++t;
+              }
+            }
+          }
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Executes the action of a transition and changes state.
+    //*************************************************************************
+    void execute_transition(const transition& t, parameter_t data)
+    {
+      // Shall we execute the action?
+      if (t.action != ETL_NULLPTR)
+      {
 #if ETL_USING_CPP11
-                (TObject_Ref.*t->action)(etl::forward<parameter_t>(data));
+        (TObject_Ref.*t.action)(etl::forward<parameter_t>(data));
 #else
-                (TObject_Ref.*t->action)(data);
+        (TObject_Ref.*t.action)(data);
 #endif
-              }
-
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
-              {
-                const state* s;
+      }
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+      // Changing state?
+      if (this->current_state_id != t.next_state_id)
+      {
+        const state* s;
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_exit))();
-                }
+        // See if we have a state item for the current state.
+        s = find_state(this->current_state_id);
 
-                this->current_state_id = t->next_state_id;
+        // If the current state has an 'on_exit' then call it.
+        if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_exit != ETL_NULLPTR))
+        {
+          (TObject_Ref.*(s->on_exit))();
+        }
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+        this->current_state_id = t.next_state_id;
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (TObject_Ref.*(s->on_entry))();
-                }
-              }
+        // See if we have a state item for the new state.
+        s = find_state(this->current_state_id);
 
-              t = (Transition_Table_Begin + Transition_Table_Size);
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
-          }
+        // If the new state has an 'on_entry' then call it.
+        if ((s != (State_Table_Begin + State_Table_Size)) && (s->on_entry != ETL_NULLPTR))
+        {
+          (TObject_Ref.*(s->on_entry))();
         }
       }
     }
 
-  private:
-
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
+      if (lookup.is_valid())
+      {
+        const istate_chart_lookup::index_t index = lookup.find_state(state_id);
+
+        return (index == istate_chart_lookup::No_Index) ? (State_Table_Begin + State_Table_Size) : (State_Table_Begin + index);
+      }
+
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
     }
 
@@ -590,9 +1020,22 @@ namespace etl
     state_chart_ctp(const state_chart_ctp&) ETL_DELETE;
     state_chart_ctp& operator=(const state_chart_ctp&) ETL_DELETE;
 
+    typedef etl::state_chart_lookup<Max_States, Max_Events, (Max_States == 0U) ? 0U : Transition_Table_Size> lookup_t;
+
+    static const lookup_t lookup; ///< The lookup of the tables. Not valid if Max_States is zero.
+
     bool started; ///< Set if the state chart has been started.
   };
 
+  template <typename TObject, typename TParameter, TObject& TObject_Ref,
+            const etl::state_chart_traits::transition<TObject, TParameter>* Transition_Table_Begin, size_t Transition_Table_Size,
+            const etl::state_chart_traits::state<TObject>* State_Table_Begin, size_t State_Table_Size,
+            etl::state_chart_traits::state_id_t Initial_State, size_t Max_States, size_t Max_Events>
+  const typename state_chart_ctp<TObject, TParameter, TObject_Ref, Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size,
+                                 Initial_State, Max_States, Max_Events>::lookup_t
+    state_chart_ctp<TObject, TParameter, TObject_Ref, Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size, Initial_State,
+                    Max_States, Max_Events>::lookup(Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size);
+
   //***************************************************************************
   /// Simple Finite State Machine
   /// Runtime tables.
@@ -624,10 +1067,36 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
+      , p_lookup(ETL_NULLPTR)
+      , transition_table_size(transition_table_end_ - transition_table_begin_)
+      , state_table_size(state_table_end_ - state_table_begin_)
+      , started(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Events are dispatched through a lookup, built here from the tables.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    /// \param lookup_                 The lookup of the tables.
+    //*************************************************************************
+    state_chart(TObject& object_, const transition* transition_table_begin_, const transition* transition_table_end_, const state* state_table_begin_,
+                const state* state_table_end_, const state_id_t state_id_, etl::istate_chart_lookup& lookup_)
+      : istate_chart<TParameter>(state_id_)
+      , object(object_)
+      , transition_table_begin(transition_table_begin_)
+      , state_table_begin(state_table_begin_)
+      , p_lookup(&lookup_)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
       , started(false)
     {
+      build_lookup();
     }
 
     //*************************************************************************
@@ -639,6 +1108,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size  = transition_table_end_ - transition_table_begin_;
+
+      build_lookup();
     }
 
     //*************************************************************************
@@ -650,6 +1121,20 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size  = state_table_end_ - state_table_begin_;
+
+      build_lookup();
+    }
+
+    //*************************************************************************
+    /// Sets the lookup that events are dispatched through, and builds it from
+    /// the tables.
+    /// \param lookup_ The lookup of the tables.
+    //*************************************************************************
+    void set_lookup(etl::istate_chart_lookup& lookup_)
+    {
+      p_lookup = &lookup_;
+
+      build_lookup();
     }
 
     //*************************************************************************
@@ -703,71 +1188,98 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table_begin;
-
-        // Keep looping until we execute a transition or reach the end of the
-        // table.
-        while (t != transition_table_end())
+        if (use_lookup())
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          istate_chart_lookup::transition_range range = p_lookup->find_transitions(this->current_state_id, event_id);
 
-          // Found an entry?
-          if (t != transition_table_end())
+          // Execute the first transition whose guard passes.
+          for (istate_chart_lookup::index_t i = range.next(); i != istate_chart_lookup::No_Index; i = range.next())
           {
-            // Shall we execute the transition?
+            const transition* t = transition_table_begin + i;
+
             if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
+              execute_transition(*t, data);
+              break;
+            }
+          }
+        }
+        else
+        {
+          const transition* t = transition_table_begin;
+
+          // Keep looping until we execute a transition or reach the end of the
+          // table.
+          while (t != transition_table_end())
+          {
+            // Scan the transition table from the latest position.
+            t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+
+            // Found an entry?
+            if (t != transition_table_end())
+            {
+              // Shall we execute the transition?
+              if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
               {
+                execute_transition(*t, data);
+
+                t = transition_table_end();
+              }
+              else
+              {
+                // Start the search from the next item in the table.
+                ++t;
+              }
+            }
+          }
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Executes the action of a transition and changes state.
+    //*************************************************************************
+    void execute_transition(const transition& t, parameter_t data)
+    {
+      // Shall we execute the action?
+      if (t.action != ETL_NULLPTR)
+      {
 #if ETL_USING_CPP11
-                (object.*t->action)(etl::forward<parameter_t>(data));
+        (object.*t.action)(etl::forward<parameter_t>(data));
 #else
-                (object.*t->action)(data);
+        (object.*t.action)(data);
 #endif
-              }
-
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
-              {
-                const state* s;
+      }
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+      // Changing state?
+      if (this->current_state_id != t.next_state_id)
+      {
+        const state* s;
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table_end()) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (object.*(s->on_exit))();
-                }
+        // See if we have a state item for the current state.
+        s = find_state(this->current_state_id);
 
-                this->current_state_id = t->next_state_id;
+        // If the current state has an 'on_exit' then call it.
+        if ((s != state_table_end()) && (s->on_exit != ETL_NULLPTR))
+        {
+          (object.*(s->on_exit))();
+        }
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+        this->current_state_id = t.next_state_id;
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table_end()) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
+        // See if we have a state item for the new state.
+        s = find_state(this->current_state_id);
 
-              t = transition_table_end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
-          }
+        // If the new state has an 'on_entry' then call it.
+        if ((s != state_table_end()) && (s->on_entry != ETL_NULLPTR))
+        {
+          (object.*(s->on_entry))();
         }
       }
     }
 
-  private:
-
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
@@ -778,6 +1290,12 @@ namespace etl
       {
         return state_table_end();
       }
+      else if (use_lookup())
+      {
+        const istate_chart_lookup::index_t index = p_lookup->find_state(state_id);
+
+        return (index == istate_chart_lookup::No_Index) ? state_table_end() : (state_table_begin + index);
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
@@ -790,6 +1308,25 @@ namespace etl
       return transition_table_begin + transition_table_size;
     }
 
+    //*************************************************************************
+    /// Rebuilds the lookup, if there is one, from the tables.
+    //*************************************************************************
+    void build_lookup()
+    {
+      if (p_lookup != ETL_NULLPTR)
+      {
+        p_lookup->build(transition_table_begin, transition_table_size, state_table_begin, (state_table_begin == ETL_NULLPTR) ? 0U : state_table_size);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if events are dispatched through the lookup.
+    //*************************************************************************
+    bool use_lookup() const
+    {
+      return (p_lookup != ETL_NULLPTR) && p_lookup->is_valid();
+    }
+
     //*************************************************************************
     const state* state_table_end() const
     {
@@ -834,12 +1371,13 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator=(const state_chart&) ETL_DELETE;
 
-    TObject&          object;                 ///< The object that supplies guard and action member functions.
-    const transition* transition_table_begin; ///< The start of the table of transitions.
-    const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
-    bool              started;                ///< Set if the state chart has been started.
+    TObject&             object;                 ///< The object that supplies guard and action member functions.
+    const transition*    transition_table_begin; ///< The start of the table of transitions.
+    const state*         state_table_begin;      ///< The start of the table of states.
+    istate_chart_lookup* p_lookup;               ///< The lookup of the tables, if used.
+    uint_least8_t        transition_table_size;  ///< The size of the table of transitions.
+    uint_least8_t        state_table_size;       ///< The size of the table of states.
+    bool                 started;                ///< Set if the state chart has been started.
   };
 
   //***************************************************************************
@@ -873,12 +1411,38 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
+      , p_lookup(ETL_NULLPTR)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
       , started(false)
     {
     }
 
+    //*************************************************************************
+    /// Constructor.
+    /// Events are dispatched through a lookup, built here from the tables.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    /// \param lookup_                 The lookup of the tables.
+    //*************************************************************************
+    state_chart(TObject& object_, const transition* transition_table_begin_, const transition* transition_table_end_, const state* state_table_begin_,
+                const state* state_table_end_, const state_id_t state_id_, etl::istate_chart_lookup& lookup_)
+      : istate_chart<void>(state_id_)
+      , object(object_)
+      , transition_table_begin(transition_table_begin_)
+      , state_table_begin(state_table_begin_)
+      , p_lookup(&lookup_)
+      , transition_table_size(transition_table_end_ - transition_table_begin_)
+      , state_table_size(state_table_end_ - state_table_begin_)
+      , started(false)
+    {
+      build_lookup();
+    }
+
     //*************************************************************************
     /// Sets the transition table.
     /// \param state_table_begin_ The start of the state table.
@@ -888,6 +1452,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size  = transition_table_end_ - transition_table_begin_;
+
+      build_lookup();
     }
 
     //*************************************************************************
@@ -899,6 +1465,20 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size  = state_table_end_ - state_table_begin_;
+
+      build_lookup();
+    }
+
+    //*************************************************************************
+    /// Sets the lookup that events are dispatched through, and builds it from
+    /// the tables.
+    /// \param lookup_ The lookup of the tables.
+    //*************************************************************************
+    void set_lookup(etl::istate_chart_lookup& lookup_)
+    {
+      p_lookup = &lookup_;
+
+      build_lookup();
     }
 
     //*************************************************************************
@@ -952,67 +1532,94 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table_begin;
-
-        // Keep looping until we execute a transition or reach the end of the
-        // table.
-        while (t != transition_table_end())
+        if (use_lookup())
         {
-          // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          istate_chart_lookup::transition_range range = p_lookup->find_transitions(this->current_state_id, event_id);
 
-          // Found an entry?
-          if (t != transition_table_end())
+          // Execute the first transition whose guard passes.
+          for (istate_chart_lookup::index_t i = range.next(); i != istate_chart_lookup::No_Index; i = range.next())
           {
-            // Shall we execute the transition?
+            const transition* t = transition_table_begin + i;
+
             if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
+              execute_transition(*t);
+              break;
+            }
+          }
+        }
+        else
+        {
+          const transition* t = transition_table_begin;
+
+          // Keep looping until we execute a transition or reach the end of the
+          // table.
+          while (t != transition_table_end())
+          {
+            // Scan the transition table from the latest position.
+            t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+
+            // Found an entry?
+            if (t != transition_table_end())
+            {
+              // Shall we execute the transition?
+              if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
               {
-                (object.*t->action)();
-              }
+                execute_transition(*t);
 
-              // Changing state?
-              if (this->current_state_id != t->next_state_id)
+                t = transition_table_end();
+              }
+              else
               {
-                const state* s;
+                // Start the search from the next item in the table.
+                ++t;
+              }
+            }
+          }
+        }
+      }
+    }
 
-                // See if we have a state item for the current state.
-                s = find_state(this->current_state_id);
+  private:
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table_end()) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (object.*(s->on_exit))();
-                }
+    //*************************************************************************
+    /// Executes the action of a transition and changes state.
+    //*************************************************************************
+    void execute_transition(const transition& t)
+    {
+      // Shall we execute the action?
+      if (t.action != ETL_NULLPTR)
+      {
+        (object.*t.action)();
+      }
 
-                this->current_state_id = t->next_state_id;
+      // Changing state?
+      if (this->current_state_id != t.next_state_id)
+      {
+        const state* s;
 
-                // See if we have a state item for the new state.
-                s = find_state(this->current_state_id);
+        // See if we have a state item for the current state.
+        s = find_state(this->current_state_id);
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table_end()) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
+        // If the current state has an 'on_exit' then call it.
+        if ((s != state_table_end()) && (s->on_exit != ETL_NULLPTR))
+        {
+          (object.*(s->on_exit))();
+        }
 
-              t = transition_table_end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
-          }
+        this->current_state_id = t.next_state_id;
+
+        // See if we have a state item for the new state.
+        s = find_state(this->current_state_id);
+
+        // If the new state has an 'on_entry' then call it.
+        if ((s != state_table_end()) && (s->on_entry != ETL_NULLPTR))
+        {
+          (object.*(s->on_entry))();
         }
       }
     }
 
-  private:
-
     //*************************************************************************
     /// Gets the current state id.
     /// \return The current state id.
@@ -1023,6 +1630,12 @@ namespace etl
       {
         return state_table_end();
       }
+      else if (use_lookup())
+      {
+        const istate_chart_lookup::index_t index = p_lookup->find_state(state_id);
+
+        return (index == istate_chart_lookup::No_Index) ? state_table_end() : (state_table_begin + index);
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
@@ -1035,6 +1648,25 @@ namespace etl
       return transition_table_begin + transition_table_size;
     }
 
+    //*************************************************************************
+    /// Rebuilds the lookup, if there is one, from the tables.
+    //*************************************************************************
+    void build_lookup()
+    {
+      if (p_lookup != ETL_NULLPTR)
+      {
+        p_lookup->build(transition_table_begin, transition_table_size, state_table_begin, (state_table_begin == ETL_NULLPTR) ? 0U : state_table_size);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if events are dispatched through the lookup.
+    //*************************************************************************
+    bool use_lookup() const
+    {
+      return (p_lookup != ETL_NULLPTR) && p_lookup->is_valid();
+    }
+
     //*************************************************************************
     const state* state_table_end() const
     {
@@ -1079,12 +1711,13 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator=(const state_chart&) ETL_DELETE;
 
-    TObject&          object;                 ///< The object that supplies guard and action member functions.
-    const transition* transition_table_begin; ///< The start of the table of transitions.
-    const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
-    bool              started;                ///< Set if the state chart has been started.
+    TObject&             object;                 ///< The object that supplies guard and action member functions.
+    const transition*    transition_table_begin; ///< The start of the table of transitions.
+    const state*         state_table_begin;      ///< The start of the table of states.
+    istate_chart_lookup* p_lookup;               ///< The lookup of the tables, if used.
+    uint_least8_t        transition_table_size;  ///< The size of the table of transitions.
+    uint_least8_t        state_table_size;       ///< The size of the table of states.
+    bool                 started;                ///< Set if the state chart has been started.
   };
 } // namespace etl
 
@@ -0,0 +1,484 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TDIGEST_INCLUDED
+#define ETL_TDIGEST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <math.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_tdigest
+  {
+    //***************************************************
+    /// add_insert_iterator
+    /// An output iterator used to add new values.
+    //***************************************************
+    template <typename TDigest>
+    class add_insert_iterator : public etl::iterator<ETL_OR_STD::output_iterator_tag, void, void, void, void>
+    {
+    public:
+
+      //***********************************
+      explicit add_insert_iterator(TDigest& digest) ETL_NOEXCEPT
+        : p_digest(&digest)
+      {
+      }
+
+      //***********************************
+      add_insert_iterator& operator*() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++(int) ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator=(typename TDigest::value_type value)
+      {
+        p_digest->add(value);
+        return *this;
+      }
+
+    private:
+
+      TDigest* p_digest;
+    };
+
+    //***************************************************
+    /// A cluster of values, represented by their mean and number.
+    //***************************************************
+    struct centroid
+    {
+      double mean;
+      double weight;
+    };
+
+    //***************************************************
+    /// Orders centroids by mean.
+    //***************************************************
+    struct centroid_less
+    {
+      bool operator()(const centroid& lhs, const centroid& rhs) const
+      {
+        return lhs.mean < rhs.mean;
+      }
+    };
+  } // namespace private_tdigest
+
+  //***************************************************************************
+  /// A t-digest, for estimating any quantile of a stream in fixed memory.
+  /// Values are clustered into centroids, which are kept small near the
+  /// extremes and larger near the median, using the log-odds scale function.
+  /// This gives good relative accuracy for tail quantiles, such as p99 and
+  /// p99.9.
+  /// Values are gathered in a buffer and merged into the centroids when it is
+  /// full, as in Dunning's merging t-digest. Digests may be merged, so each
+  /// thread or node may keep its own.
+  ///\tparam TInput      The input value type.
+  ///\tparam Compression The compression factor. There are at most
+  /// Compression + 2 centroids.
+  ///\tparam Buffer_Size The number of values gathered before each merge.
+  ///\ingroup maths
+  //***************************************************************************
+  template <typename TInput, size_t Compression = 100U, size_t Buffer_Size = Compression>
+  class tdigest : public etl::unary_function<TInput, void>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Compression >= 10U, "Compression must be at least 10");
+    ETL_STATIC_ASSERT(Buffer_Size > 0U, "Buffer_Size must be greater than zero");
+
+    typedef TInput                                       value_type;
+    typedef tdigest<TInput, Compression, Buffer_Size>    this_t;
+    typedef private_tdigest::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t Max_Centroids = Compression + 2U;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    tdigest()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    tdigest(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      if (buffer_count == Buffer_Size)
+      {
+        flush();
+      }
+
+      const double x = double(value);
+
+      buffer[buffer_count].mean   = x;
+      buffer[buffer_count].weight = 1.0;
+      ++buffer_count;
+
+      if (x < min_value)
+      {
+        min_value = x;
+      }
+
+      if (x > max_value)
+      {
+        max_value = x;
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Gets an add_insert_iterator for input.
+    //*********************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+    //*********************************
+    /// Adds the values summarised by another digest.
+    //*********************************
+    template <size_t Other_Compression, size_t Other_Buffer_Size>
+    void merge(const tdigest<TInput, Other_Compression, Other_Buffer_Size>& other)
+    {
+      other.flush();
+      flush();
+
+      merge_centroids(other.centroids, other.centroid_count);
+
+      if (other.min_value < min_value)
+      {
+        min_value = other.min_value;
+      }
+
+      if (other.max_value > max_value)
+      {
+        max_value = other.max_value;
+      }
+    }
+
+    //*********************************
+    /// Get the estimate of a quantile.
+    ///\param probability The quantile. Range 0 to 1, so 0.99 is p99.
+    //*********************************
+    double get_quantile(double probability) const
+    {
+      flush();
+
+      if (centroid_count == 0U)
+      {
+        return 0.0;
+      }
+
+      if ((probability <= 0.0) || (centroid_count == 1U))
+      {
+        return (probability <= 0.0) ? min_value : centroids[0].mean;
+      }
+
+      if (probability >= 1.0)
+      {
+        return max_value;
+      }
+
+      const double index = probability * total_weight;
+
+      // Before the centre of the first centroid.
+      const double first_half = centroids[0].weight / 2.0;
+
+      if (index < first_half)
+      {
+        return min_value + ((centroids[0].mean - min_value) * index / first_half);
+      }
+
+      // Between the centres of two centroids.
+      double cumulative = first_half;
+
+      for (size_t i = 0U; i < (centroid_count - 1U); ++i)
+      {
+        const double step = (centroids[i].weight + centroids[i + 1U].weight) / 2.0;
+
+        if ((cumulative + step) > index)
+        {
+          const double t = (index - cumulative) / step;
+
+          return centroids[i].mean + (t * (centroids[i + 1U].mean - centroids[i].mean));
+        }
+
+        cumulative += step;
+      }
+
+      // After the centre of the last centroid.
+      const centroid_t& last      = centroids[centroid_count - 1U];
+      const double      last_half = last.weight / 2.0;
+      const double      t         = (index - cumulative) / last_half;
+
+      return (t >= 1.0) ? max_value : last.mean + (t * (max_value - last.mean));
+    }
+
+    //*********************************
+    /// Get the estimate of the median.
+    //*********************************
+    double get_median() const
+    {
+      return get_quantile(0.5);
+    }
+
+    //*********************************
+    /// Get the smallest value added.
+    //*********************************
+    double get_min() const
+    {
+      return (count() == 0U) ? 0.0 : min_value;
+    }
+
+    //*********************************
+    /// Get the largest value added.
+    //*********************************
+    double get_max() const
+    {
+      return (count() == 0U) ? 0.0 : max_value;
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(total_weight) + buffer_count;
+    }
+
+    //*********************************
+    /// Get the number of centroids, after merging the buffer.
+    //*********************************
+    size_t centroids_used() const
+    {
+      flush();
+
+      return centroid_count;
+    }
+
+    //*********************************
+    /// Clear the digest.
+    //*********************************
+    void clear()
+    {
+      centroid_count = 0U;
+      buffer_count   = 0U;
+      total_weight   = 0.0;
+      min_value      = HUGE_VAL;
+      max_value      = -HUGE_VAL;
+    }
+
+  private:
+
+    template <typename, size_t, size_t>
+    friend class tdigest;
+
+    typedef private_tdigest::centroid centroid_t;
+
+    //*********************************
+    /// Merges the buffered values into the centroids.
+    //*********************************
+    void flush() const
+    {
+      if (buffer_count != 0U)
+      {
+        etl::sort(buffer, buffer + buffer_count, private_tdigest::centroid_less());
+
+        merge_centroids(buffer, buffer_count);
+
+        buffer_count = 0U;
+      }
+    }
+
+    //*********************************
+    /// Merges sorted, weighted values with the centroids.
+    /// Neighbours are combined while the combined centroid would span no more
+    /// than one unit of the scale function.
+    //*********************************
+    void merge_centroids(const centroid_t* incoming, size_t incoming_count) const
+    {
+      if (incoming_count == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < incoming_count; ++i)
+      {
+        total_weight += incoming[i].weight;
+      }
+
+      const centroid_t* existing     = centroids;
+      const centroid_t* existing_end = centroids + centroid_count;
+      const centroid_t* incoming_end = incoming + incoming_count;
+
+      size_t     output_count = 0U;
+      centroid_t current      = next_in_order(existing, existing_end, incoming, incoming_end);
+
+      const double normaliser    = scale_normaliser();
+      double       weight_so_far = 0.0;
+
+      while ((existing != existing_end) || (incoming != incoming_end))
+      {
+        const centroid_t next = next_in_order(existing, existing_end, incoming, incoming_end);
+
+        const double combined = current.weight + next.weight;
+        const double q        = (weight_so_far + (combined / 2.0)) / total_weight;
+
+        if ((combined <= (normaliser * q * (1.0 - q))) || (output_count == (Max_Centroids - 1U)))
+        {
+          // Combine into the current centroid.
+          current.weight += next.weight;
+          current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        }
+        else
+        {
+          weight_so_far += current.weight;
+
+          merged[output_count++] = current;
+          current                = next;
+        }
+      }
+
+      merged[output_count++] = current;
+
+      for (size_t i = 0U; i < output_count; ++i)
+      {
+        centroids[i] = merged[i];
+      }
+
+      centroid_count = output_count;
+    }
+
+    //*********************************
+    /// Takes the next centroid, in order of mean, from the two sequences.
+    //*********************************
+    static centroid_t next_in_order(const centroid_t*& existing, const centroid_t* existing_end, const centroid_t*& incoming, const centroid_t* incoming_end)
+    {
+      if ((incoming == incoming_end) || ((existing != existing_end) && (existing->mean <= incoming->mean)))
+      {
+        return *existing++;
+      }
+
+      return *incoming++;
+    }
+
+    //*********************************
+    /// The largest weight of a centroid at quantile q is n * Z * q * (1 - q) / delta,
+    /// from the log-odds scale function k(q) = (delta / Z) * ln(q / (1 - q)),
+    /// where Z = 4 * ln(n / delta) + 24.
+    /// Returns n * Z / delta.
+    //*********************************
+    double scale_normaliser() const
+    {
+      const double ratio = total_weight / double(Compression);
+      const double z     = (4.0 * log((ratio > 1.0) ? ratio : 1.0)) + 24.0;
+
+      return total_weight * z / double(Compression);
+    }
+
+    mutable centroid_t centroids[Max_Centroids];
+    mutable centroid_t merged[Max_Centroids];
+    mutable centroid_t buffer[Buffer_Size];
+    mutable size_t     centroid_count;
+    mutable size_t     buffer_count;
+    mutable double     total_weight;
+    double             min_value;
+    double             max_value;
+  };
+
+  template <typename TInput, size_t Compression, size_t Buffer_Size>
+  ETL_CONSTANT size_t tdigest<TInput, Compression, Buffer_Size>::Max_Centroids;
+} // namespace etl
+
+#endif
@@ -340,10 +340,10 @@ namespace etl
     struct integral_accumulator
     {
       //*********************************
-      ETL_CONSTEXPR14 integral_accumulator(etl::radix::value_type radix_, TValue maximum_)
+      ETL_CONSTEXPR14 integral_accumulator(etl::radix::value_type radix_, TValue maximum_, TValue initial_value_ = 0)
         : radix(radix_)
         , maximum(maximum_)
-        , integral_value(0)
+        , integral_value(initial_value_)
         , conversion_status(to_arithmetic_status::Valid)
       {
       }
@@ -592,6 +592,242 @@ namespace etl
       to_arithmetic_status conversion_status;
     };
 
+    //***************************************************************************
+    /// SWAR (SIMD within a register) decimal digit parsing.
+    /// Eight characters are packed into a 64 bit word, first character in the
+    /// least significant byte, then validated and converted in parallel.
+    //***************************************************************************
+#if ETL_USING_64BIT_TYPES
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 uint64_t swar_load_8(const TChar* p)
+    {
+      return (static_cast<uint64_t>(static_cast<uint8_t>(p[0])))       |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[1])) << 8)  |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[2])) << 16) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[3])) << 24) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[4])) << 32) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[5])) << 40) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[6])) << 48) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[7])) << 56);
+    }
+
+    //*******************************************
+    /// Returns true if all eight bytes are in the range '0' to '9'.
+    //*******************************************
+    ETL_NODISCARD
+    inline
+      ETL_CONSTEXPR14 bool swar_is_8_digits(uint64_t chunk)
+    {
+      return ((chunk & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+              (((chunk + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) == UINT64_C(0x3333333333333333);
+    }
+
+    //*******************************************
+    /// Converts eight packed decimal digits to their value.
+    //*******************************************
+    ETL_NODISCARD
+    inline
+      ETL_CONSTEXPR14 uint32_t swar_parse_8_digits(uint64_t chunk)
+    {
+      const uint64_t Mask        = UINT64_C(0x000000FF000000FF);
+      const uint64_t Multiplier1 = UINT64_C(100) + (UINT64_C(1000000) << 32);
+      const uint64_t Multiplier2 = UINT64_C(1) + (UINT64_C(10000) << 32);
+
+      chunk -= UINT64_C(0x3030303030303030);
+      chunk = (chunk * 10U) + (chunk >> 8);
+      chunk = (((chunk & Mask) * Multiplier1) + (((chunk >> 16) & Mask) * Multiplier2)) >> 32;
+
+      return static_cast<uint32_t>(chunk);
+    }
+#endif
+
+    //***************************************************************************
+    /// Returns 10^exponent for 0 <= exponent <= 22.
+    /// Built from exactly representable powers so that the result is exact for
+    /// every exponent that the floating point fast path will use.
+    //***************************************************************************
+    template <typename TValue>
+    ETL_NODISCARD ETL_CONSTEXPR14 TValue exact_power_of_ten(int exponent)
+    {
+      TValue result = static_cast<TValue>(1.0);
+      TValue factor = static_cast<TValue>(10.0);
+
+      while (exponent != 0)
+      {
+        if ((exponent & 1) != 0)
+        {
+          result *= factor;
+        }
+
+        exponent >>= 1;
+
+        if (exponent != 0)
+        {
+          factor *= factor;
+        }
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Limits for the exact floating point fast path.
+    /// The mantissa must be exactly representable and 10^exponent must be exact.
+    //***************************************************************************
+    template <typename TValue>
+    struct floating_point_fast_path_limits
+    {
+      static ETL_CONSTANT int Max_Exponent = (etl::numeric_limits<TValue>::digits >= 53) ? 22 : (etl::numeric_limits<TValue>::digits >= 24) ? 10 : 0;
+      static ETL_CONSTANT int Mantissa_Bits = (etl::numeric_limits<TValue>::digits >= 53) ? 53 : etl::numeric_limits<TValue>::digits;
+    };
+
+    template <typename TValue>
+    ETL_CONSTANT int floating_point_fast_path_limits<TValue>::Max_Exponent;
+
+    template <typename TValue>
+    ETL_CONSTANT int floating_point_fast_path_limits<TValue>::Mantissa_Bits;
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Fast path for decimal floating point text (Clinger's algorithm).
+    /// Parses the text into an integral mantissa and a decimal exponent. If both
+    /// are small enough that the mantissa and the power of ten are exact, the
+    /// result is a single correctly rounded multiply or divide.
+    /// Only '.' is taken as the radix point. Anything else, including ',', is
+    /// left to the general accumulator.
+    /// Returns false if the text must be handled by the general accumulator.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 bool fast_floating_point(const etl::basic_string_view<TChar>& view, TValue& value)
+    {
+      typedef floating_point_fast_path_limits<TValue> limits;
+
+      typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
+      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+
+      bool is_negative = false;
+
+      if ((itr != itr_end) && ((*itr == char_constant::Positive_Char) || (*itr == char_constant::Negative_Char)))
+      {
+        is_negative = (*itr == char_constant::Negative_Char);
+        ++itr;
+      }
+
+      uint64_t mantissa     = 0U;
+      int      digits       = 0;
+      int      exponent     = 0;
+      bool     found_digits = false;
+
+      // Integral digits.
+      while ((itr != itr_end) && (*itr >= '0') && (*itr <= '9'))
+      {
+        if ((mantissa != 0U) || (*itr != '0'))
+        {
+          if (++digits > 19)
+          {
+            return false;
+          }
+
+          mantissa = (mantissa * 10U) + static_cast<uint64_t>(*itr - '0');
+        }
+
+        found_digits = true;
+        ++itr;
+      }
+
+      // Fractional digits.
+      if ((itr != itr_end) && (*itr == char_constant::Radix_Point1_Char))
+      {
+        ++itr;
+
+        while ((itr != itr_end) && (*itr >= '0') && (*itr <= '9'))
+        {
+          if ((mantissa != 0U) || (*itr != '0'))
+          {
+            if (++digits > 19)
+            {
+              return false;
+            }
+
+            mantissa = (mantissa * 10U) + static_cast<uint64_t>(*itr - '0');
+          }
+
+          --exponent;
+          found_digits = true;
+          ++itr;
+        }
+      }
+
+      if (!found_digits)
+      {
+        return false;
+      }
+
+      // Exponent.
+      if ((itr != itr_end) && ((*itr == char_constant::Exponential_Char) || (*itr == 'E')))
+      {
+        ++itr;
+
+        bool is_negative_exponent = false;
+
+        if ((itr != itr_end) && ((*itr == char_constant::Positive_Char) || (*itr == char_constant::Negative_Char)))
+        {
+          is_negative_exponent = (*itr == char_constant::Negative_Char);
+          ++itr;
+        }
+
+        int explicit_exponent = 0;
+
+        while ((itr != itr_end) && (*itr >= '0') && (*itr <= '9'))
+        {
+          if (explicit_exponent > 1000)
+          {
+            return false;
+          }
+
+          explicit_exponent = (explicit_exponent * 10) + (*itr - '0');
+          ++itr;
+        }
+
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+      }
+
+      // Anything left over is handled by the general parser.
+      if (itr != itr_end)
+      {
+        return false;
+      }
+
+      if ((mantissa >> limits::Mantissa_Bits) != 0U)
+      {
+        return false;
+      }
+
+      if ((exponent < -limits::Max_Exponent) || (exponent > limits::Max_Exponent))
+      {
+        return false;
+      }
+
+      value = static_cast<TValue>(mantissa);
+
+      if (exponent < 0)
+      {
+        value /= exact_power_of_ten<TValue>(-exponent);
+      }
+      else
+      {
+        value *= exact_power_of_ten<TValue>(exponent);
+      }
+
+      if (is_negative)
+      {
+        value = -value;
+      }
+
+      return true;
+    }
+#endif
+
     //***************************************************************************
     // Define an unsigned accumulator type that is at least as large as TValue.
     //***************************************************************************
@@ -637,7 +873,30 @@ namespace etl
       typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
       const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-      integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
+      TAccumulatorType initial_value = 0;
+
+#if ETL_USING_64BIT_TYPES
+      // Decimal fast path. Consume eight digits at a time while the result cannot overflow.
+      if ((radix == etl::radix::decimal) && (sizeof(TChar) == 1U) && (maximum > TAccumulatorType(99999999U)))
+      {
+        const TAccumulatorType limit = (maximum - TAccumulatorType(99999999U)) / TAccumulatorType(100000000U);
+
+        while (((itr_end - itr) >= 8) && (initial_value <= limit))
+        {
+          const uint64_t chunk = swar_load_8(itr);
+
+          if (!swar_is_8_digits(chunk))
+          {
+            break;
+          }
+
+          initial_value = (initial_value * TAccumulatorType(100000000U)) + static_cast<TAccumulatorType>(swar_parse_8_digits(chunk));
+          itr += 8;
+        }
+      }
+#endif
+
+      integral_accumulator<TAccumulatorType> accumulator(radix, maximum, initial_value);
 
       while ((itr != itr_end) && accumulator.add(convert(*itr)))
       {
@@ -809,6 +1068,12 @@ namespace etl
 
   //***************************************************************************
   /// Floating point from view.
+  /// The result is correctly rounded when the significant digits form an
+  /// integer below 2^53 (2^24 for float) and the decimal exponent is within
+  /// +/-22 (+/-10 for float), as it is then a single exact multiply or divide.
+  /// Other values are accumulated in long double and scaled by pow(), so may
+  /// differ from the correctly rounded value in the last bits. There is no
+  /// exact fallback, such as Eisel-Lemire, as its tables are too large.
   //***************************************************************************
   template <typename TValue, typename TChar>
   ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::to_arithmetic_result<TValue> >::type
@@ -820,11 +1085,18 @@ namespace etl
     typedef typename result_type::unexpected_type unexpected_type;
 
     result_type result;
+    TValue      fast_value = TValue(0);
 
     if (view.empty())
     {
       result = unexpected_type(to_arithmetic_status::Invalid_Format);
     }
+#if ETL_USING_64BIT_TYPES
+    else if (fast_floating_point(view, fast_value))
+    {
+      result = fast_value;
+    }
+#endif
     else
     {
       floating_point_accumulator accumulator;
@@ -868,6 +1140,7 @@ namespace etl
 
   //***************************************************************************
   /// Floating point from pointer and length.
+  /// Has the accuracy of the view overload.
   //***************************************************************************
   template <typename TValue, typename TChar>
   ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::to_arithmetic_result<TValue> >::type to_arithmetic(const TChar* cp,
@@ -878,6 +1151,7 @@ namespace etl
 
   //***************************************************************************
   /// Floating point from pointer.
+  /// Has the accuracy of the view overload.
   //***************************************************************************
   template <typename TValue, typename TChar>
   ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::to_arithmetic_result<TValue> >::type to_arithmetic(const TChar* cp)
@@ -887,6 +1161,7 @@ namespace etl
 
   //***************************************************************************
   /// Floating point from string.
+  /// Has the accuracy of the view overload.
   //***************************************************************************
   template <typename TValue, typename TChar>
   ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::to_arithmetic_result<TValue> >::type
@@ -894,6 +1169,178 @@ namespace etl
   {
     return etl::to_arithmetic<TValue, TChar>(etl::basic_string_view<TChar>(str));
   }
+
+  //***************************************************************************
+  /// Result of etl::from_chars.
+  /// Mirrors std::from_chars_result, with the error reported as an
+  /// etl::to_arithmetic_status.
+  //***************************************************************************
+  template <typename TChar>
+  struct from_chars_result
+  {
+    const TChar*              ptr;
+    etl::to_arithmetic_status ec;
+  };
+
+  namespace private_to_arithmetic
+  {
+    //***************************************************************************
+    /// Finds the end of the longest prefix that looks like an integral.
+    /// A '-' prefix is only part of it if the type is signed.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 const TChar* scan_integral(const TChar* first, const TChar* last, const etl::radix::value_type radix, bool is_signed)
+    {
+      const TChar* itr = first;
+
+      if (is_signed && (itr != last) && (*itr == char_constant::Negative_Char))
+      {
+        ++itr;
+      }
+
+      const TChar* digits_begin = itr;
+
+      while ((itr != last) && is_valid(convert(*itr), radix))
+      {
+        ++itr;
+      }
+
+      return (itr == digits_begin) ? first : itr;
+    }
+
+    //***************************************************************************
+    /// Finds the end of the longest prefix that looks like a floating point value.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 const TChar* scan_floating_point(const TChar* first, const TChar* last)
+    {
+      const TChar* itr = first;
+
+      if ((itr != last) && (*itr == char_constant::Negative_Char))
+      {
+        ++itr;
+      }
+
+      bool found_digits = false;
+
+      while ((itr != last) && is_valid(convert(*itr), etl::radix::decimal))
+      {
+        found_digits = true;
+        ++itr;
+      }
+
+      if ((itr != last) && (*itr == char_constant::Radix_Point1_Char))
+      {
+        ++itr;
+
+        while ((itr != last) && is_valid(convert(*itr), etl::radix::decimal))
+        {
+          found_digits = true;
+          ++itr;
+        }
+      }
+
+      if (!found_digits)
+      {
+        return first;
+      }
+
+      // Only consume the exponent if it is complete.
+      if ((itr != last) && (convert(*itr) == char_constant::Exponential_Char))
+      {
+        const TChar* exponent_itr = itr + 1;
+
+        if ((exponent_itr != last) && ((*exponent_itr == char_constant::Positive_Char) || (*exponent_itr == char_constant::Negative_Char)))
+        {
+          ++exponent_itr;
+        }
+
+        const TChar* exponent_digits = exponent_itr;
+
+        while ((exponent_itr != last) && is_valid(convert(*exponent_itr), etl::radix::decimal))
+        {
+          ++exponent_itr;
+        }
+
+        if (exponent_itr != exponent_digits)
+        {
+          itr = exponent_itr;
+        }
+      }
+
+      return itr;
+    }
+  } // namespace private_to_arithmetic
+
+  //***************************************************************************
+  /// Integral from a character range, in the style of std::from_chars.
+  /// Parses the longest valid prefix of [first, last). As for std::from_chars,
+  /// there is no '+' prefix, and no '-' prefix for unsigned types.
+  /// On success, 'value' is set and 'ptr' points one past the last character used.
+  /// On failure, 'value' is unmodified and 'ptr' is 'first' if no digits were found.
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_integral<TValue>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, TValue& value, const etl::radix::value_type radix = etl::radix::decimal)
+  {
+    etl::from_chars_result<TChar> result = { first, to_arithmetic_status::Invalid_Format };
+
+    if (!etl::private_to_arithmetic::is_valid_radix(radix))
+    {
+      result.ec = to_arithmetic_status::Invalid_Radix;
+    }
+    else
+    {
+      const TChar* end = etl::private_to_arithmetic::scan_integral(first, last, radix, etl::is_signed<TValue>::value);
+
+      if (end != first)
+      {
+        etl::to_arithmetic_result<TValue> conversion = etl::to_arithmetic<TValue, TChar>(etl::basic_string_view<TChar>(first, static_cast<size_t>(end - first)), radix);
+
+        result.ptr = end;
+        result.ec  = conversion.error();
+
+        if (conversion.has_value())
+        {
+          value = conversion.value();
+        }
+      }
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Floating point from a character range, in the style of std::from_chars.
+  /// Parses the longest valid prefix of [first, last). The radix point is '.'.
+  /// The result has the accuracy of etl::to_arithmetic, so is not always
+  /// correctly rounded.
+  /// On success, 'value' is set and 'ptr' points one past the last character used.
+  /// On failure, 'value' is unmodified and 'ptr' is 'first' if no digits were found.
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  ETL_NODISCARD ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, TValue& value)
+  {
+    etl::from_chars_result<TChar> result = { first, to_arithmetic_status::Invalid_Format };
+
+    const TChar* end = etl::private_to_arithmetic::scan_floating_point(first, last);
+
+    if (end != first)
+    {
+      etl::to_arithmetic_result<TValue> conversion = etl::to_arithmetic<TValue, TChar>(etl::basic_string_view<TChar>(first, static_cast<size_t>(end - first)));
+
+      result.ptr = end;
+      result.ec  = conversion.error();
+
+      if (conversion.has_value())
+      {
+        value = conversion.value();
+      }
+    }
+
+    return result;
+  }
 } // namespace etl
 
 //***************************************************************************
@@ -0,0 +1,358 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOKENIZER_INCLUDED
+#define ETL_TOKENIZER_INCLUDED
+
+#include "platform.h"
+#include "char_traits.h"
+#include "iterator.h"
+#include "string_view.h"
+
+#if ETL_USING_CPP17
+  #include "ranges.h"
+#endif
+
+#include <stdint.h>
+
+///\defgroup tokenizer tokenizer
+/// Lazy tokenisation of text into string views.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// A set of delimiter characters, held as a 256 bit lookup table.
+  /// Membership is tested with a single shift and mask, independent of the
+  /// number of delimiters.
+  /// Only characters with values in the range 0 to 255 may be delimiters.
+  ///\ingroup tokenizer
+  //***************************************************************************
+  class delimiter_set
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructs an empty set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 delimiter_set()
+      : bits()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a null terminated string of delimiters.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14 explicit delimiter_set(const TChar* delimiters)
+      : bits()
+    {
+      while ((delimiters != ETL_NULLPTR) && (*delimiters != 0))
+      {
+        add(*delimiters++);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from a string view of delimiters.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14 explicit delimiter_set(const etl::basic_string_view<TChar>& delimiters)
+      : bits()
+    {
+      for (size_t i = 0U; i < delimiters.size(); ++i)
+      {
+        add(delimiters[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a delimiter to the set.
+    /// Characters outside of the range 0 to 255 are ignored.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14 void add(TChar c)
+    {
+      const uint32_t value = to_index(c);
+
+      if (value < 256U)
+      {
+        bits[value >> 5U] |= (uint32_t(1U) << (value & 0x1FU));
+      }
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the character is a delimiter.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 bool contains(TChar c) const
+    {
+      const uint32_t value = to_index(c);
+
+      return (value < 256U) && ((bits[value >> 5U] & (uint32_t(1U) << (value & 0x1FU))) != 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the first delimiter in the range, or last if none.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD ETL_CONSTEXPR14 const TChar* find_first_in(const TChar* first, const TChar* last) const
+    {
+      while ((first != last) && !contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Converts a character to an unsigned index, without sign extension.
+    //*************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD static ETL_CONSTEXPR14 uint32_t to_index(TChar c)
+    {
+      return (sizeof(TChar) == 1U) ? static_cast<uint32_t>(static_cast<uint8_t>(c)) : static_cast<uint32_t>(c);
+    }
+
+    uint32_t bits[8];
+  };
+
+  //***************************************************************************
+  /// Splits text into tokens, according to a set of delimiters.
+  /// Tokens are yielded lazily as string views into the original text, as a
+  /// forward range. The text must outlive the tokenizer.
+  /// Produces the same tokens as etl::get_token for the same arguments.
+  ///\ingroup tokenizer
+  //***************************************************************************
+  template <typename TChar>
+  class basic_tokenizer
+#if ETL_USING_CPP17
+    : public etl::ranges::view_interface<basic_tokenizer<TChar>>
+#endif
+  {
+  public:
+
+    typedef etl::basic_string_view<TChar> string_view_type;
+    typedef string_view_type              value_type;
+    typedef size_t                        size_type;
+
+    //*************************************************************************
+    /// Iterator over the tokens.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const string_view_type>
+    {
+    public:
+
+      friend class basic_tokenizer;
+
+      //***********************************
+      iterator()
+        : p_tokenizer(ETL_NULLPTR)
+        , token()
+      {
+      }
+
+      //***********************************
+      iterator& operator++()
+      {
+        token = p_tokenizer->next_token(token);
+
+        return *this;
+      }
+
+      //***********************************
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+
+        ++(*this);
+
+        return temp;
+      }
+
+      //***********************************
+      const string_view_type& operator*() const
+      {
+        return token;
+      }
+
+      //***********************************
+      const string_view_type* operator->() const
+      {
+        return &token;
+      }
+
+      //***********************************
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.token.data() == rhs.token.data()) && (lhs.token.size() == rhs.token.size());
+      }
+
+      //***********************************
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***********************************
+      iterator(const basic_tokenizer* p_tokenizer_, const string_view_type& token_)
+        : p_tokenizer(p_tokenizer_)
+        , token(token_)
+      {
+      }
+
+      const basic_tokenizer* p_tokenizer;
+      string_view_type       token;
+    };
+
+    typedef iterator const_iterator;
+
+    //*************************************************************************
+    /// Constructs from the text, a null terminated string of delimiters, and
+    /// whether to ignore empty tokens.
+    //*************************************************************************
+    basic_tokenizer(const string_view_type& input_, const TChar* delimiters_, bool ignore_empty_tokens_)
+      : input(input_)
+      , delimiters(delimiters_)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from the text, a prebuilt delimiter set, and whether to
+    /// ignore empty tokens.
+    //*************************************************************************
+    basic_tokenizer(const string_view_type& input_, const etl::delimiter_set& delimiters_, bool ignore_empty_tokens_)
+      : input(input_)
+      , delimiters(delimiters_)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first token.
+    //*************************************************************************
+    iterator begin() const
+    {
+      if (input.data() == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      return iterator(this, find_token(input.data()));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to one past the last token.
+    //*************************************************************************
+    iterator end() const
+    {
+      return iterator(this, string_view_type());
+    }
+
+    //*************************************************************************
+    /// Returns the text being tokenised.
+    //*************************************************************************
+    const string_view_type& text() const
+    {
+      return input;
+    }
+
+    //*************************************************************************
+    /// Returns the delimiter set.
+    //*************************************************************************
+    const etl::delimiter_set& get_delimiters() const
+    {
+      return delimiters;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the token that starts at or after 'first'.
+    /// Returns an empty default view if there are no more tokens.
+    //*************************************************************************
+    string_view_type find_token(const TChar* first) const
+    {
+      const TChar* const input_end = input.data() + input.size();
+
+      while (true)
+      {
+        const TChar* last = delimiters.find_first_in(first, input_end);
+
+        if ((last != first) || !ignore_empty_tokens)
+        {
+          return string_view_type(first, static_cast<size_t>(last - first));
+        }
+
+        // Empty token to be ignored. Was it the last one?
+        if (last == input_end)
+        {
+          return string_view_type();
+        }
+
+        first = last + 1;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the token after 'token'.
+    //*************************************************************************
+    string_view_type next_token(const string_view_type& token) const
+    {
+      const TChar* const token_end = token.data() + token.size();
+
+      if (token_end == (input.data() + input.size()))
+      {
+        return string_view_type();
+      }
+
+      // Step over the delimiter.
+      return find_token(token_end + 1);
+    }
+
+    string_view_type   input;
+    etl::delimiter_set delimiters;
+    bool               ignore_empty_tokens;
+  };
+
+  typedef etl::basic_tokenizer<char>     tokenizer;
+  typedef etl::basic_tokenizer<wchar_t>  wtokenizer;
+  typedef etl::basic_tokenizer<char8_t>  u8tokenizer;
+  typedef etl::basic_tokenizer<char16_t> u16tokenizer;
+  typedef etl::basic_tokenizer<char32_t> u32tokenizer;
+} // namespace etl
+
+#endif
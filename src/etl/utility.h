@@ -970,6 +970,32 @@ namespace etl
   inline constexpr in_place_index_t<Index> in_place_index{};
 #endif
 
+  //***************************************************************************
+  /// Sorted range disambiguation tags.
+  /// sorted_unique_t indicates a range sorted by strictly increasing key.
+  /// sorted_equivalent_t indicates a range sorted by non-decreasing key.
+  //***************************************************************************
+
+  //*************************
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
+  //*************************
+  struct sorted_equivalent_t
+  {
+    explicit ETL_CONSTEXPR sorted_equivalent_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_equivalent_t sorted_equivalent{};
+#endif
+
 #if ETL_USING_CPP11
   //*************************************************************************
   // A function wrapper for free/global functions.
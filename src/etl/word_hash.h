@@ -0,0 +1,278 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORD_HASH_INCLUDED
+#define ETL_WORD_HASH_INCLUDED
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "ihash.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+#if defined(ETL_COMPILER_KEIL)
+  #pragma diag_suppress 1300
+#endif
+
+///\defgroup word_hash 64 bit word hash calculation
+/// A fast non-cryptographic hash that consumes 64 bit words, in the style of
+/// wyhash. Each word costs one 64x64->128 bit multiply.
+/// The results are not compatible with wyhash or xxHash.
+///\ingroup maths
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  // Forward declaration.
+  template <typename T, size_t Extent>
+  class span;
+
+  namespace private_word_hash
+  {
+    template <typename T = void>
+    struct constants
+    {
+      static ETL_CONSTANT uint64_t Secret0 = 0xA0761D6478BD642FULL;
+      static ETL_CONSTANT uint64_t Secret1 = 0xE7037ED1A0B428DBULL;
+      static ETL_CONSTANT uint64_t Secret2 = 0x8EBC6AF09C88C6E3ULL;
+    };
+
+    template <typename T>
+    ETL_CONSTANT uint64_t constants<T>::Secret0;
+
+    template <typename T>
+    ETL_CONSTANT uint64_t constants<T>::Secret1;
+
+    template <typename T>
+    ETL_CONSTANT uint64_t constants<T>::Secret2;
+
+    //*************************************************************************
+    /// Multiplies two 64 bit values to 128 bits and folds the halves together,
+    /// with both inputs.
+    /// Folding in the inputs means that a zero product does not discard the
+    /// other input. Without it, a word that cancels its secret would reset the
+    /// hash, and everything before it would be lost.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+  #if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t product = static_cast<uint128_t>(a) * b;
+
+      return a ^ b ^ static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64U);
+  #else
+      const uint64_t a_lo = a & 0xFFFFFFFFULL;
+      const uint64_t a_hi = a >> 32U;
+      const uint64_t b_lo = b & 0xFFFFFFFFULL;
+      const uint64_t b_hi = b >> 32U;
+
+      const uint64_t lo_lo = a_lo * b_lo;
+      const uint64_t hi_lo = a_hi * b_lo;
+      const uint64_t lo_hi = a_lo * b_hi;
+      const uint64_t hi_hi = a_hi * b_hi;
+
+      const uint64_t cross = (lo_lo >> 32U) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+
+      const uint64_t lo = (cross << 32U) | (lo_lo & 0xFFFFFFFFULL);
+      const uint64_t hi = hi_hi + (hi_lo >> 32U) + (cross >> 32U);
+
+      return a ^ b ^ lo ^ hi;
+  #endif
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit word.
+    //*************************************************************************
+    inline uint64_t read_word(const uint8_t* p)
+    {
+      return (static_cast<uint64_t>(p[0]))       |
+             (static_cast<uint64_t>(p[1]) << 8)  |
+             (static_cast<uint64_t>(p[2]) << 16) |
+             (static_cast<uint64_t>(p[3]) << 24) |
+             (static_cast<uint64_t>(p[4]) << 32) |
+             (static_cast<uint64_t>(p[5]) << 40) |
+             (static_cast<uint64_t>(p[6]) << 48) |
+             (static_cast<uint64_t>(p[7]) << 56);
+    }
+
+    //*************************************************************************
+    /// Adds a whole word to the hash.
+    //*************************************************************************
+    inline uint64_t add_word(uint64_t hash, uint64_t word)
+    {
+      return mix(word ^ constants<>::Secret1, hash ^ constants<>::Secret2);
+    }
+
+    //*************************************************************************
+    /// Adds the partial tail word and the total length to the hash.
+    //*************************************************************************
+    inline uint64_t finalise(uint64_t hash, uint64_t tail, uint64_t tail_length, uint64_t length)
+    {
+      hash = mix(tail ^ constants<>::Secret1, hash ^ constants<>::Secret2 ^ tail_length);
+
+      return mix(hash ^ constants<>::Secret0, length ^ constants<>::Secret1);
+    }
+  } // namespace private_word_hash
+
+  //***************************************************************************
+  /// word_hash policy.
+  /// Bytes are gathered into little endian 64 bit words, so the result is the
+  /// same as etl::word_hash over the same bytes.
+  /// frame_check_sequence only holds the hash value, so the partial word and
+  /// the length are held here, and are reset by initial().
+  /// initial() and add() change that state, so are not const. final() only
+  /// reads it, so the hash of a const word_hash_64 depends only on the bytes
+  /// added.
+  //***************************************************************************
+  struct word_hash_policy_64
+  {
+    typedef uint64_t value_type;
+
+    uint64_t initial()
+    {
+      tail        = 0U;
+      tail_length = 0U;
+      length      = 0U;
+
+      return private_word_hash::constants<>::Secret0;
+    }
+
+    uint64_t add(uint64_t hash, uint8_t value)
+    {
+      tail |= static_cast<uint64_t>(value) << (tail_length * 8U);
+      ++length;
+
+      if (++tail_length == 8U)
+      {
+        hash        = private_word_hash::add_word(hash, tail);
+        tail        = 0U;
+        tail_length = 0U;
+      }
+
+      return hash;
+    }
+
+    uint64_t final(uint64_t hash) const
+    {
+      return private_word_hash::finalise(hash, tail, tail_length, length);
+    }
+
+    uint64_t tail;
+    uint64_t tail_length;
+    uint64_t length;
+  };
+
+  //***************************************************************************
+  /// Calculates the 64 bit word hash incrementally.
+  ///\ingroup word_hash
+  //***************************************************************************
+  class word_hash_64 : public etl::frame_check_sequence<etl::word_hash_policy_64>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    word_hash_64()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    word_hash_64(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the 64 bit word hash of a contiguous block of memory in one
+  /// call, reading whole words directly.
+  ///\ingroup word_hash
+  //***************************************************************************
+  inline uint64_t word_hash(const uint8_t* begin, const uint8_t* end)
+  {
+    const uint64_t length = static_cast<uint64_t>(end - begin);
+
+    uint64_t hash = private_word_hash::constants<>::Secret0;
+
+    while ((end - begin) >= 8)
+    {
+      hash = private_word_hash::add_word(hash, private_word_hash::read_word(begin));
+      begin += 8;
+    }
+
+    uint64_t tail        = 0U;
+    uint64_t tail_length = 0U;
+
+    while (begin != end)
+    {
+      tail |= static_cast<uint64_t>(*begin++) << (tail_length * 8U);
+      ++tail_length;
+    }
+
+    return private_word_hash::finalise(hash, tail, tail_length, length);
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit word hash of a block of memory.
+  ///\ingroup word_hash
+  //***************************************************************************
+  inline uint64_t word_hash(const void* data, size_t length)
+  {
+    const uint8_t* begin = static_cast<const uint8_t*>(data);
+
+    return etl::word_hash(begin, begin + length);
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit word hash of the bytes of a span.
+  ///\ingroup word_hash
+  //***************************************************************************
+  template <typename T, size_t Extent>
+  uint64_t word_hash(const etl::span<T, Extent>& view)
+  {
+    return etl::word_hash(static_cast<const void*>(view.data()), view.size_bytes());
+  }
+} // namespace etl
+
+#endif
+
+#endif
@@ -0,0 +1,487 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_EXECUTOR_INCLUDED
+#define ETL_WORK_STEALING_EXECUTOR_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "function.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "power.h"
+#include "private/bounded_mpmc_queue.h"
+#include "scheduler.h"
+#include "static_assert.h"
+#include "task.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_work_stealing
+  {
+    //*************************************************************************
+    /// A fixed capacity Chase-Lev deque of task indexes.
+    /// The owning worker pushes and pops at the bottom. Other workers steal
+    /// from the top.
+    //*************************************************************************
+    template <size_t Capacity>
+    class chase_lev_deque
+    {
+    public:
+
+      ETL_STATIC_ASSERT(etl::is_power_of_2<Capacity>::value, "Capacity must be a power of 2");
+
+      static ETL_CONSTANT uint32_t Empty = etl::integral_limits<uint32_t>::max;
+
+      //***********************************
+      chase_lev_deque()
+      {
+        top.store(0U);
+        bottom.store(0U);
+
+        for (size_t i = 0U; i < Capacity; ++i)
+        {
+          buffer[i].store(Empty, etl::memory_order_relaxed);
+        }
+      }
+
+      //***********************************
+      /// Pushes at the bottom. Owner only.
+      //***********************************
+      bool push(uint32_t item)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed);
+        const uint32_t t = top.load(etl::memory_order_acquire);
+
+        if ((b - t) >= Capacity)
+        {
+          return false;
+        }
+
+        buffer[b & Mask].store(item, etl::memory_order_relaxed);
+        bottom.store(b + 1U, etl::memory_order_release);
+
+        return true;
+      }
+
+      //***********************************
+      /// Pops from the bottom. Owner only.
+      //***********************************
+      uint32_t pop()
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed) - 1U;
+        bottom.store(b);
+
+        uint32_t t = top.load();
+
+        if (int32_t(b - t) < 0)
+        {
+          // Empty.
+          bottom.store(b + 1U, etl::memory_order_relaxed);
+          return Empty;
+        }
+
+        uint32_t item = buffer[b & Mask].load(etl::memory_order_relaxed);
+
+        if (b == t)
+        {
+          // The last item, so race any thieves for it.
+          if (!top.compare_exchange_strong(t, t + 1U))
+          {
+            item = Empty;
+          }
+
+          bottom.store(b + 1U, etl::memory_order_relaxed);
+        }
+
+        return item;
+      }
+
+      //***********************************
+      /// Steals from the top. Any thread.
+      //***********************************
+      uint32_t steal()
+      {
+        uint32_t       t = top.load();
+        const uint32_t b = bottom.load();
+
+        if (int32_t(b - t) <= 0)
+        {
+          return Empty;
+        }
+
+        const uint32_t item = buffer[t & Mask].load(etl::memory_order_relaxed);
+
+        if (!top.compare_exchange_strong(t, t + 1U))
+        {
+          return Empty;
+        }
+
+        return item;
+      }
+
+      //***********************************
+      /// Gets the item that would be stolen next, without taking it.
+      /// The result may be out of date.
+      //***********************************
+      uint32_t peek() const
+      {
+        const uint32_t t = top.load();
+        const uint32_t b = bottom.load();
+
+        return (int32_t(b - t) <= 0) ? Empty : buffer[t & Mask].load(etl::memory_order_relaxed);
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Mask = uint32_t(Capacity - 1U);
+
+      etl::atomic<uint32_t> top;
+      etl::atomic<uint32_t> bottom;
+      etl::atomic<uint32_t> buffer[Capacity];
+    };
+
+    template <size_t Capacity>
+    ETL_CONSTANT uint32_t chase_lev_deque<Capacity>::Empty;
+
+    template <size_t Capacity>
+    ETL_CONSTANT uint32_t chase_lev_deque<Capacity>::Mask;
+  } // namespace private_work_stealing
+
+  //***************************************************************************
+  /// Runs etl::tasks on several worker threads.
+  /// Each worker has a fixed capacity Chase-Lev deque of tasks. Tasks
+  /// submitted from outside the workers go to a shared injection queue. A
+  /// worker runs tasks from its own deque first, then from the injection
+  /// queue, and then steals the highest priority task at the top of the other
+  /// workers' deques.
+  /// A task is queued at most once at a time, so it never runs on two workers
+  /// at once. After each call to task_process_work() the task is queued again
+  /// if task_request_work() still reports work.
+  /// The executor does not create threads. Each worker thread calls
+  /// run_worker() with its own index. Nothing is allocated after construction.
+  /// Tasks must be added before the workers are started. If work can arrive
+  /// for a task from other threads, its task_request_work() must be thread
+  /// safe.
+  ///\tparam Workers     The number of worker threads.
+  ///\tparam Queue_Depth The capacity of each worker's deque. Rounded up to a
+  /// power of 2.
+  ///\tparam Max_Tasks   The maximum number of tasks.
+  //***************************************************************************
+  template <size_t Workers, size_t Queue_Depth, size_t Max_Tasks = Queue_Depth>
+  class work_stealing_executor
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Workers > 0U, "There must be at least one worker");
+    ETL_STATIC_ASSERT(Max_Tasks > 0U, "There must be at least one task");
+
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    work_stealing_executor()
+      : task_count(0U)
+      , p_idle_callback(ETL_NULLPTR)
+    {
+      executor_exit.store(false);
+
+      for (size_t i = 0U; i < Max_Tasks; ++i)
+      {
+        task_list[i] = ETL_NULLPTR;
+        queued[i].store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Set the idle callback.
+    /// Called by a worker, with its index, when it finds nothing to do.
+    //*******************************************
+    void set_idle_callback(etl::ifunction<size_t>& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Adds a task.
+    /// Not thread safe. Add all tasks before starting the workers.
+    ///\return The id of the task, used to submit it, or npos if there are
+    /// too many tasks.
+    //*******************************************
+    size_t add_task(etl::task& task)
+    {
+      if (task_count == Max_Tasks)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+        return npos;
+      }
+
+      const size_t id = task_count++;
+
+      task_list[id] = &task;
+      task.on_task_added();
+
+      return id;
+    }
+
+    //*******************************************
+    /// Queues a task on the injection queue, if it is not already queued.
+    /// May be called from any thread.
+    //*******************************************
+    void submit(size_t id)
+    {
+      if (mark_queued(id))
+      {
+        push_injection(uint32_t(id));
+      }
+    }
+
+    //*******************************************
+    /// Queues a task on a worker's deque, if it is not already queued.
+    /// Must only be called from that worker's thread.
+    //*******************************************
+    void submit(size_t id, size_t worker)
+    {
+      if (mark_queued(id))
+      {
+        push_local(uint32_t(id), worker);
+      }
+    }
+
+    //*******************************************
+    /// Queues every task that reports work.
+    /// For tasks whose work arrives without a call to submit().
+    ///\return The number of tasks that report work.
+    //*******************************************
+    size_t submit_tasks_with_work()
+    {
+      size_t count = 0U;
+
+      for (size_t id = 0U; id < task_count; ++id)
+      {
+        if (task_list[id]->task_request_work() > 0U)
+        {
+          submit(id);
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Runs one task, once.
+    ///\return <b>true</b> if a task was run.
+    //*******************************************
+    bool run_one(size_t worker)
+    {
+      uint32_t id = deques[worker].pop();
+
+      if ((id == Empty) && !injection.pop(id))
+      {
+        id = Empty;
+      }
+
+      if (id == Empty)
+      {
+        id = steal(worker);
+      }
+
+      if (id == Empty)
+      {
+        return false;
+      }
+
+      etl::task& task = *task_list[id];
+
+      task.task_process_work();
+
+      if (task.task_request_work() > 0U)
+      {
+        // Still queued, so it cannot have been queued elsewhere.
+        push_local(id, worker);
+      }
+      else
+      {
+        queued[id].store(false);
+
+        // Work may have arrived after the check, and its submit() ignored.
+        if ((task.task_request_work() > 0U) && mark_queued(id))
+        {
+          push_local(id, worker);
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Runs tasks until exit_executor() is called.
+    /// Called from each worker thread, with the worker's index.
+    //*******************************************
+    void run_worker(size_t worker)
+    {
+      while (!executor_exit.load(etl::memory_order_relaxed))
+      {
+        if (!run_one(worker) && (p_idle_callback != ETL_NULLPTR))
+        {
+          (*p_idle_callback)(worker);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Tells the workers to return from run_worker().
+    //*******************************************
+    void exit_executor()
+    {
+      executor_exit.store(true);
+    }
+
+    //*******************************************
+    /// Gets the number of tasks.
+    //*******************************************
+    size_t size() const
+    {
+      return task_count;
+    }
+
+    //*******************************************
+    /// Gets the number of workers.
+    //*******************************************
+    static ETL_CONSTEXPR size_t number_of_workers()
+    {
+      return Workers;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t   Deque_Capacity     = etl::power_of_2_round_up<Queue_Depth>::value;
+    static ETL_CONSTANT size_t   Injection_Capacity = etl::power_of_2_round_up<Max_Tasks>::value;
+    static ETL_CONSTANT uint32_t Empty              = etl::integral_limits<uint32_t>::max;
+
+    typedef private_work_stealing::chase_lev_deque<Deque_Capacity>     deque_t;
+    typedef private_bounded_mpmc_queue::bounded_mpmc_queue<uint32_t, Injection_Capacity> injection_t;
+
+    //*******************************************
+    /// Marks a task as queued.
+    ///\return <b>true</b> if it was not already queued.
+    //*******************************************
+    bool mark_queued(size_t id)
+    {
+      if (id >= task_count)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::scheduler_null_task_exception));
+        return false;
+      }
+
+      return !queued[id].exchange(true);
+    }
+
+    //*******************************************
+    /// Pushes to a worker's deque, or to the injection queue if it is full.
+    //*******************************************
+    void push_local(uint32_t id, size_t worker)
+    {
+      if (!deques[worker].push(id))
+      {
+        push_injection(id);
+      }
+    }
+
+    //*******************************************
+    /// Pushes to the injection queue.
+    /// A task is queued at most once, so there is always room for it, but a
+    /// push fails while a pop on another thread holds the cell that it needs.
+    /// The id cannot be dropped, as the task is already marked as queued, so
+    /// the push is retried until that pop completes.
+    //*******************************************
+    void push_injection(uint32_t id)
+    {
+      while (!injection.push(id))
+      {
+      }
+    }
+
+    //*******************************************
+    /// Steals the highest priority task at the top of another worker's deque.
+    //*******************************************
+    uint32_t steal(size_t thief)
+    {
+      size_t victim        = Workers;
+      int    best_priority = -1;
+
+      for (size_t offset = 1U; offset < Workers; ++offset)
+      {
+        const size_t   worker = (thief + offset) % Workers;
+        const uint32_t id     = deques[worker].peek();
+
+        if ((id != Empty) && (int(task_list[id]->get_task_priority()) > best_priority))
+        {
+          victim        = worker;
+          best_priority = int(task_list[id]->get_task_priority());
+        }
+      }
+
+      return (victim == Workers) ? Empty : deques[victim].steal();
+    }
+
+    deque_t                 deques[Workers];
+    injection_t             injection;
+    etl::task*              task_list[Max_Tasks];
+    etl::atomic<bool>       queued[Max_Tasks]; ///< Whether each task is in a queue.
+    size_t                  task_count;
+    etl::atomic<bool>       executor_exit;
+    etl::ifunction<size_t>* p_idle_callback;
+  };
+
+  template <size_t Workers, size_t Queue_Depth, size_t Max_Tasks>
+  ETL_CONSTANT size_t work_stealing_executor<Workers, Queue_Depth, Max_Tasks>::npos;
+
+  template <size_t Workers, size_t Queue_Depth, size_t Max_Tasks>
+  ETL_CONSTANT size_t work_stealing_executor<Workers, Queue_Depth, Max_Tasks>::Deque_Capacity;
+
+  template <size_t Workers, size_t Queue_Depth, size_t Max_Tasks>
+  ETL_CONSTANT size_t work_stealing_executor<Workers, Queue_Depth, Max_Tasks>::Injection_Capacity;
+
+  template <size_t Workers, size_t Queue_Depth, size_t Max_Tasks>
+  ETL_CONSTANT uint32_t work_stealing_executor<Workers, Queue_Depth, Max_Tasks>::Empty;
+} // namespace etl
+
+#endif
+
+#endif